@@ -35,6 +35,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <mutex>
 #include <iomanip>
@@ -75,11 +76,14 @@
 #define API_DUMP_ENV_VAR_FLUSH_FILE "VK_APIDUMP_FLUSH"
 #define API_DUMP_ENV_VAR_OUTPUT_RANGE "VK_APIDUMP_OUTPUT_RANGE"
 #define API_DUMP_ENV_VAR_TIMESTAMP "VK_APIDUMP_TIMESTAMP"
+#define API_DUMP_ENV_VAR_FRAME_INDEX "VK_APIDUMP_FRAME_INDEX"
+#define API_DUMP_ENV_VAR_AGGREGATE_CMD_BUFFERS "VK_APIDUMP_AGGREGATE_CMD_BUFFERS"
 
 enum class ApiDumpFormat {
     Text,
     Html,
     Json,
+    Ndjson,  // Json, with each API call written as a single line
 };
 
 static const uint64_t OUTPUT_RANGE_UNLIMITED = 0;
@@ -260,6 +264,7 @@ class ApiDumpSettings {
         // If one of the above has set a filename, open the file as an output stream.
         if (!filename_string.empty()) {
             use_cout = false;
+            output_filename = filename_string;
             output_stream.open(filename_string, std::ofstream::out | std::ostream::trunc);
             size_t last_slash_idx = filename_string.find_last_of("\\/");
             if (std::string::npos != last_slash_idx) {
@@ -280,6 +285,8 @@ class ApiDumpSettings {
                 output_format = ApiDumpFormat::Html;
             } else if (ToLowerString(env_value) == "json") {
                 output_format = ApiDumpFormat::Json;
+            } else if (ToLowerString(env_value) == "ndjson") {
+                output_format = ApiDumpFormat::Ndjson;
             } else {
                 output_format = ApiDumpFormat::Text;
             }
@@ -317,6 +324,28 @@ class ApiDumpSettings {
         show_shader = readBoolOption("lunarg_api_dump.show_shader", false);
         show_thread_and_frame = readBoolOption("lunarg_api_dump.show_thread_and_frame", true);
 
+        aggregate_cmd_buffers = readBoolOption("lunarg_api_dump.aggregate_cmd_buffers", false);
+        env_value = GetPlatformEnvVar(API_DUMP_ENV_VAR_AGGREGATE_CMD_BUFFERS);
+        if (!env_value.empty()) {
+            aggregate_cmd_buffers = GetStringBooleanValue(env_value);
+        }
+
+        // The frame index is a sidecar file next to the output file, so it requires output to a file
+        use_frame_index = readBoolOption("lunarg_api_dump.frame_index", false);
+        env_value = GetPlatformEnvVar(API_DUMP_ENV_VAR_FRAME_INDEX);
+        if (!env_value.empty()) {
+            use_frame_index = GetStringBooleanValue(env_value);
+        }
+        use_frame_index = use_frame_index && !use_cout;
+        if (use_frame_index) {
+            openFrameIndex(filename_string);
+        }
+
+        // Log rotation starts a new output file at a frame or call boundary, see rotateOutputFile()
+        log_max_size = static_cast<uint64_t>(std::max(readIntOption("lunarg_api_dump.log_max_size", 0), 0)) * 1024 * 1024;
+        log_max_frames = static_cast<uint64_t>(std::max(readIntOption("lunarg_api_dump.log_max_frames", 0), 0));
+        log_max_files = static_cast<uint64_t>(std::max(readIntOption("lunarg_api_dump.log_max_files", 0), 0));
+
         std::string cond_range_string;
         env_value = GetPlatformEnvVar(API_DUMP_ENV_VAR_OUTPUT_RANGE);
         if (!env_value.empty()) {
@@ -334,7 +363,199 @@ class ApiDumpSettings {
             }
         }
 
-        // Generate HTML heading if specified
+        writeHeader();
+
+        if (isFrameInRange(0)) {
+            setupInterFrameOutputFormatting(0);
+        }
+    }
+
+    ~ApiDumpSettings() {
+        writeFooter();
+        if (!use_cout) output_stream.close();
+    }
+
+    void setupInterFrameOutputFormatting(uint64_t frame_count) const /*name change? */
+    {
+        if (frame_count > 0) {
+            if (condFrameOutput.isFrameInRange(frame_count - 1)) closeFrameOutput();
+        }
+        continued_frame = false;
+        if (condFrameOutput.isFrameInRange(frame_count)) {
+            if (shouldRotateOutputFile()) rotateOutputFile();
+            ++file_frame_count;
+            openFrameOutput(frame_count);
+        }
+    }
+
+    void openFrameOutput(uint64_t frame_count) const {
+        switch (format()) {
+            case (ApiDumpFormat::Html):
+                writeFrameIndex(frame_count);
+                stream() << "<details class='frm'><summary>Frame ";
+                if (show_thread_and_frame) {
+                    stream() << frame_count;
+                }
+                stream() << "</summary>";
+                break;
+
+            case (ApiDumpFormat::Json):
+                if (!has_printed_frame) {
+                    has_printed_frame = true;
+                } else {
+                    stream() << ",\n";
+                }
+                writeFrameIndex(frame_count);
+                stream() << "{\n";
+                if (show_thread_and_frame) {
+                    stream() << indentation(1) << "\"frameNumber\" : \"" << frame_count << "\",\n";
+                }
+                stream() << indentation(1) << "\"apiCalls\" :\n";
+                stream() << indentation(1) << "[\n";
+                break;
+            case (ApiDumpFormat::Text):
+            case (ApiDumpFormat::Ndjson):
+                writeFrameIndex(frame_count);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Record the offset in the output file where the frame starts, apidump-slice.py uses the index to extract frames
+    // without reading the output file from the start.
+    void writeFrameIndex(uint64_t frame_count) const {
+        if (!index_stream.is_open()) return;
+
+        index_stream << "frame " << frame_count << " " << outputOffset() << "\n";
+        if (should_flush) index_stream.flush();
+    }
+
+    void closeFrameOutput() const {
+        switch (format()) {
+            case (ApiDumpFormat::Html):
+                stream() << "</details>";
+                break;
+            case (ApiDumpFormat::Json):
+                stream() << "\n" << indentation(1) << "]\n}";
+                break;
+            case (ApiDumpFormat::Text):
+                break;
+            default:
+                break;
+        }
+    }
+
+    inline ApiDumpFormat format() const { return output_format; }
+
+    inline const char *formatName() const {
+        switch (output_format) {
+            case (ApiDumpFormat::Html):
+                return "html";
+            case (ApiDumpFormat::Json):
+                return "json";
+            case (ApiDumpFormat::Ndjson):
+                return "ndjson";
+            default:
+                return "text";
+        }
+    }
+
+    std::ostream &formatNameType(std::ostream &stream, int indents, const char *name, const char *type) const {
+        stream << indentation(indents) << name << ": ";
+
+        if (use_spaces)
+            stream << spaces(name_size - (int)strlen(name) - 2);
+        else
+            stream << tabs((name_size - (int)strlen(name) - 3 + indent_size) / indent_size);
+
+        if (show_type && use_spaces)
+            stream << type << spaces(type_size - (int)strlen(type));
+        else if (show_type && !use_spaces)
+            stream << type << tabs((type_size - (int)strlen(type) - 1 + indent_size) / indent_size);
+
+        return stream << " = ";
+    }
+
+    inline const char *indentation(int indents) const {
+        if (output_format == ApiDumpFormat::Ndjson)
+            return "";
+        else if (use_spaces)
+            return spaces(indents * indent_size);
+        else
+            return tabs(indents);
+    }
+
+    inline bool shouldFlush() const { return should_flush; }
+
+    inline bool showAddress() const { return show_address; }
+
+    inline bool showParams() const { return show_params; }
+
+    inline bool showShader() const { return show_shader; }
+
+    inline bool showType() const { return show_type; }
+
+    inline bool showTimestamp() const { return show_timestamp; }
+
+    inline bool showThreadAndFrame() const { return show_thread_and_frame; }
+
+    inline bool aggregateCmdBuffers() const { return aggregate_cmd_buffers; }
+
+    // With Ndjson, the json backend writes each API call to a line buffer, see writeLine()
+    inline std::ostream &stream() const {
+        if (output_format == ApiDumpFormat::Ndjson) return line_stream;
+        return outputStream();
+    }
+
+    // Write the API call buffered by the json backend as a single line, so that each line of the output is a complete
+    // json object even if the application is terminated while dumping.
+    void writeLine() const {
+        std::string line = line_stream.str();
+        line.erase(std::remove(line.begin(), line.end(), '\n'), line.end());
+
+        std::ostream &output = outputStream();
+        output << line << '\n';
+        if (should_flush) output.flush();
+
+        line_stream.str("");
+        line_stream.clear();
+    }
+
+    // Between beginRecordCapture() and endRecordCapture(), the output of an API call is captured instead of written, so
+    // that the commands recorded in a command buffer can be written together when it is submitted, see writeRecord().
+    void beginRecordCapture() const { capture_record = true; }
+
+    std::string endRecordCapture() const {
+        capture_record = false;
+        std::string record = record_stream.str();
+        record_stream.str("");
+        record_stream.clear();
+        return record;
+    }
+
+    inline bool isCapturingRecord() const { return capture_record; }
+
+    void writeRecord(const std::string &record) const {
+        std::ostream &output = outputStream();
+        output << record;
+        if (should_flush) output.flush();
+    }
+
+    inline std::string directory() const { return output_dir; }
+
+    inline bool isFrameInRange(uint64_t frame) const { return condFrameOutput.isFrameInRange(frame); }
+
+   private:
+    inline std::ostream &outputStream() const {
+        if (capture_record) return record_stream;
+        return use_cout ? std::cout : *(std::ofstream *)&output_stream;
+    }
+
+    inline uint64_t outputOffset() const { return static_cast<uint64_t>((*(std::ofstream *)&output_stream).tellp()); }
+
+    // Generate the HTML or JSON heading of an output file, the dumped frames follow it
+    void writeHeader() const {
         if (output_format == ApiDumpFormat::Html) {
             // clang-format off
             // Insert html heading
@@ -440,13 +661,15 @@ class ApiDumpSettings {
         } else if (output_format == ApiDumpFormat::Json) {
             stream() << "[\n";
         }
+    }
 
-        if (isFrameInRange(0)) {
-            setupInterFrameOutputFormatting(0);
+    // The footer follows the last frame of an output file
+    void writeFooter() const {
+        if (index_stream.is_open()) {
+            index_stream << "end " << outputOffset() << "\n";
+            index_stream.close();
         }
-    }
 
-    ~ApiDumpSettings() {
         if (output_format == ApiDumpFormat::Html) {
             // Close off html
             stream() << "</div></body></html>";
@@ -454,113 +677,80 @@ class ApiDumpSettings {
             // Close off json
             stream() << "\n]" << std::endl;
         }
-        if (!use_cout) output_stream.close();
     }
 
-    void setupInterFrameOutputFormatting(uint64_t frame_count) const /*name change? */
-    {
-        static bool hasPrintedAFrame = false;
-        switch (format()) {
-            case (ApiDumpFormat::Html):
-                if (frame_count > 0) {
-                    if (condFrameOutput.isFrameInRange(frame_count - 1)) stream() << "</details>";
-                }
-                if (condFrameOutput.isFrameInRange(frame_count)) {
-                    stream() << "<details class='frm'><summary>Frame ";
-                    if (show_thread_and_frame) {
-                        stream() << frame_count;
-                    }
-                    stream() << "</summary>";
-                }
-                break;
+    // A new output file is started before a dumped frame once the current file reaches log_max_size or holds
+    // log_max_frames frames. A frame that alone grows the file past log_max_size is split, see rotateOutputFileAfterCall().
+    bool shouldRotateOutputFile() const {
+        if (use_cout || file_frame_count == 0) return false;
+        if (log_max_frames > 0 && file_frame_count >= log_max_frames) return true;
+        if (log_max_size > 0 && outputOffset() >= log_max_size) return true;
+        return false;
+    }
 
-            case (ApiDumpFormat::Json):
+    // The size is also checked after each dumped API call, outside of a command buffer record capture, so that a single
+    // large frame cannot grow the output file without bound.
+    bool shouldRotateOutputFileAfterCall() const {
+        if (use_cout || capture_record || log_max_size == 0 || file_frame_count == 0) return false;
+        return outputOffset() >= log_max_size;
+    }
 
-                if (frame_count > 0) {
-                    if (condFrameOutput.isFrameInRange(frame_count - 1)) stream() << "\n" << indentation(1) << "]\n}";
-                }
-                if (condFrameOutput.isFrameInRange(frame_count)) {
-                    if (!hasPrintedAFrame) {
-                        hasPrintedAFrame = true;
-                    } else {
-                        stream() << ",\n";
-                    }
-                    stream() << "{\n";
-                    if (show_thread_and_frame) {
-                        stream() << indentation(1) << "\"frameNumber\" : \"" << frame_count << "\",\n";
-                    }
-                    stream() << indentation(1) << "\"apiCalls\" :\n";
-                    stream() << indentation(1) << "[\n";
-                }
-                break;
-            case (ApiDumpFormat::Text):
-                break;
-            default:
-                break;
-        }
+    // Close the current frame at the call boundary, and continue it in the next output file, indexed again there
+    void rotateOutputFileAfterCall(uint64_t frame_count) const {
+        closeFrameOutput();
+        rotateOutputFile();
+        ++file_frame_count;
+        openFrameOutput(frame_count);
+        continued_frame = true;
     }
 
-    void closeFrameOutput() const {
-        switch (format()) {
-            case (ApiDumpFormat::Html):
-                stream() << "</details>";
-                break;
-            case (ApiDumpFormat::Json):
-                stream() << "\n" << indentation(1) << "]\n}";
-                break;
-            case (ApiDumpFormat::Text):
-                break;
-            default:
-                break;
+    // The first API call of a frame continued in a new output file is written without a separator
+    bool firstCallOfContinuedFrame() const {
+        if (continued_frame) {
+            continued_frame = false;
+            return true;
         }
+        return false;
     }
 
-    inline ApiDumpFormat format() const { return output_format; }
-
-    std::ostream &formatNameType(std::ostream &stream, int indents, const char *name, const char *type) const {
-        stream << indentation(indents) << name << ": ";
+    // Close the current output file with its footer and continue in <name>.<N>.<ext> with a new header, so that each
+    // file is a complete document. Only the last log_max_files files are kept.
+    void rotateOutputFile() const {
+        std::ofstream &output = *(std::ofstream *)&output_stream;
+        writeFooter();
+        output.close();
+
+        ++file_number;
+        std::string filename = rotatedFilename(file_number);
+        output.open(filename, std::ofstream::out | std::ostream::trunc);
+        if (use_frame_index) openFrameIndex(filename);
+        has_printed_frame = false;
+        file_frame_count = 0;
+        writeHeader();
+
+        if (log_max_files > 0 && file_number >= log_max_files) {
+            std::string removed_filename = rotatedFilename(file_number - log_max_files);
+            std::remove(removed_filename.c_str());
+            std::remove((removed_filename + ".idx").c_str());
+        }
+    }
 
-        if (use_spaces)
-            stream << spaces(name_size - (int)strlen(name) - 2);
-        else
-            stream << tabs((name_size - (int)strlen(name) - 3 + indent_size) / indent_size);
+    std::string rotatedFilename(uint64_t number) const {
+        if (number == 0) return output_filename;
 
-        if (show_type && use_spaces)
-            stream << type << spaces(type_size - (int)strlen(type));
-        else if (show_type && !use_spaces)
-            stream << type << tabs((type_size - (int)strlen(type) - 1 + indent_size) / indent_size);
-
-        return stream << " = ";
+        size_t last_slash_idx = output_filename.find_last_of("\\/");
+        size_t last_dot_idx = output_filename.find_last_of('.');
+        if (last_dot_idx == std::string::npos || (last_slash_idx != std::string::npos && last_dot_idx < last_slash_idx)) {
+            return output_filename + "." + std::to_string(number);
+        }
+        return output_filename.substr(0, last_dot_idx) + "." + std::to_string(number) + output_filename.substr(last_dot_idx);
     }
 
-    inline const char *indentation(int indents) const {
-        if (use_spaces)
-            return spaces(indents * indent_size);
-        else
-            return tabs(indents);
+    void openFrameIndex(const std::string &filename) const {
+        index_stream.open(filename + ".idx", std::ofstream::out | std::ostream::trunc);
+        index_stream << "format " << formatName() << "\n";
     }
 
-    inline bool shouldFlush() const { return should_flush; }
-
-    inline bool showAddress() const { return show_address; }
-
-    inline bool showParams() const { return show_params; }
-
-    inline bool showShader() const { return show_shader; }
-
-    inline bool showType() const { return show_type; }
-
-    inline bool showTimestamp() const { return show_timestamp; }
-
-    inline bool showThreadAndFrame() const { return show_thread_and_frame; }
-
-    inline std::ostream &stream() const { return use_cout ? std::cout : *(std::ofstream *)&output_stream; }
-
-    inline std::string directory() const { return output_dir; }
-
-    inline bool isFrameInRange(uint64_t frame) const { return condFrameOutput.isFrameInRange(frame); }
-
-   private:
     // Utility member to enable easier comparison by forcing a string to all lower-case
     inline static std::string ToLowerString(const std::string &value) {
         std::string lower_value = value;
@@ -646,6 +836,8 @@ class ApiDumpSettings {
             return ApiDumpFormat::Html;
         else if (lowered_option == "json")
             return ApiDumpFormat::Json;
+        else if (lowered_option == "ndjson")
+            return ApiDumpFormat::Ndjson;
         else
             return default_value;
     }
@@ -656,7 +848,19 @@ class ApiDumpSettings {
 
     bool use_cout;
     std::string output_dir = "";
+    std::string output_filename = "";
     std::ofstream output_stream;
+    mutable std::ostringstream line_stream;
+    mutable std::ofstream index_stream;
+    bool use_frame_index;
+    mutable bool has_printed_frame = false;
+
+    uint64_t log_max_size;
+    uint64_t log_max_frames;
+    uint64_t log_max_files;
+    mutable uint64_t file_number = 0;
+    mutable uint64_t file_frame_count = 0;
+    mutable bool continued_frame = false;
     ApiDumpFormat output_format;
     bool show_params;
     bool show_address;
@@ -670,6 +874,10 @@ class ApiDumpSettings {
     bool use_spaces;
     bool show_shader;
     bool show_thread_and_frame;
+    bool aggregate_cmd_buffers;
+
+    mutable std::ostringstream record_stream;
+    mutable bool capture_record = false;
 
     bool use_conditional_output = false;
     ConditionalFrameOutput condFrameOutput;
@@ -715,6 +923,14 @@ class ApiDumpInstance {
         first_func_call_on_frame = true;
     }
 
+    // Called at the end of a dumped API call, while the output mutex is held
+    inline void rotateOutputFileAfterCall() {
+        if (!settings().shouldRotateOutputFileAfterCall()) return;
+
+        std::lock_guard<std::recursive_mutex> lg(frame_mutex);
+        settings().rotateOutputFileAfterCall(frame_count);
+    }
+
     inline bool shouldDumpOutput() {
         if (!conditional_initialized) {
             should_dump_output = settings().isFrameInRange(frame_count);
@@ -779,6 +995,7 @@ class ApiDumpInstance {
 
                 assert(cmd_buffer_level.count(cmd_buffer) > 0);
                 cmd_buffer_level.erase(cmd_buffer);
+                cmd_buffer_records.erase(cmd_buffer);
             }
         }
     }
@@ -804,12 +1021,64 @@ class ApiDumpInstance {
                 for (const auto cmd_buffer : cmd_buffers_iter->second) {
                     assert(cmd_buffer_level.count(cmd_buffer) > 0);
                     cmd_buffer_level.erase(cmd_buffer);
+                    cmd_buffer_records.erase(cmd_buffer);
                 }
                 cmd_buffers_iter->second.clear();
             }
         }
     }
 
+    // With aggregate_cmd_buffers, the output of the commands recorded in a command buffer is kept until the command buffer
+    // is submitted, and discarded when it is reset or freed.
+    inline void beginCmdBufferRecord() {
+        if (settings().aggregateCmdBuffers()) settings().beginRecordCapture();
+    }
+
+    inline void endCmdBufferRecord(VkCommandBuffer cmd_buffer) {
+        if (!settings().aggregateCmdBuffers()) return;
+
+        std::string record = settings().endRecordCapture();
+        std::lock_guard<std::recursive_mutex> lg(cmd_buffer_state_mutex);
+        cmd_buffer_records[cmd_buffer].push_back(std::move(record));
+    }
+
+    // The commands of the secondary command buffers follow vkCmdExecuteCommands in the primary command buffer
+    inline void executeCmdBufferRecords(VkCommandBuffer cmd_buffer, uint32_t secondary_count,
+                                        const VkCommandBuffer *secondary_cmd_buffers) {
+        if (!settings().aggregateCmdBuffers() || secondary_cmd_buffers == nullptr) return;
+
+        std::lock_guard<std::recursive_mutex> lg(cmd_buffer_state_mutex);
+        auto &records = cmd_buffer_records[cmd_buffer];
+        for (uint32_t i = 0; i < secondary_count; ++i) {
+            const auto secondary_records_iter = cmd_buffer_records.find(secondary_cmd_buffers[i]);
+            if (secondary_records_iter != cmd_buffer_records.end() && secondary_records_iter->first != cmd_buffer) {
+                records.insert(records.end(), secondary_records_iter->second.begin(), secondary_records_iter->second.end());
+            }
+        }
+    }
+
+    inline std::vector<std::string> getCmdBufferRecords(VkCommandBuffer cmd_buffer) {
+        std::lock_guard<std::recursive_mutex> lg(cmd_buffer_state_mutex);
+        const auto records_iter = cmd_buffer_records.find(cmd_buffer);
+        if (records_iter == cmd_buffer_records.end()) return std::vector<std::string>();
+        return records_iter->second;
+    }
+
+    inline void resetCmdBufferRecords(VkCommandBuffer cmd_buffer) {
+        std::lock_guard<std::recursive_mutex> lg(cmd_buffer_state_mutex);
+        cmd_buffer_records.erase(cmd_buffer);
+    }
+
+    inline void resetCmdBufferPoolRecords(VkDevice device, VkCommandPool cmd_pool) {
+        std::lock_guard<std::recursive_mutex> lg(cmd_buffer_state_mutex);
+        const auto cmd_buffers_iter = cmd_buffer_pools.find(std::make_pair(device, cmd_pool));
+        if (cmd_buffers_iter != cmd_buffer_pools.end()) {
+            for (const auto cmd_buffer : cmd_buffers_iter->second) {
+                cmd_buffer_records.erase(cmd_buffer);
+            }
+        }
+    }
+
     inline std::chrono::microseconds current_time_since_start() {
         std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
         return std::chrono::duration_cast<std::chrono::microseconds>(now - program_start);
@@ -842,6 +1111,7 @@ class ApiDumpInstance {
     std::recursive_mutex cmd_buffer_state_mutex;
     std::map<std::pair<VkDevice, VkCommandPool>, std::unordered_set<VkCommandBuffer> > cmd_buffer_pools;
     std::unordered_map<VkCommandBuffer, VkCommandBufferLevel> cmd_buffer_level;
+    std::unordered_map<VkCommandBuffer, std::vector<std::string> > cmd_buffer_records;
 
     bool conditional_initialized = false;
     bool should_dump_output = true;
@@ -871,6 +1141,44 @@ void OutputAddress(const ApiDumpSettings &settings, const void *addr, bool quote
 
 ApiDumpInstance ApiDumpInstance::current_instance;
 
+//=============================== Enum and Bitmask Table Helpers ==================================//
+
+// The generated enum and bitmask tables are shared by the text, html and json backends. Each table ends with a
+// terminator entry whose name is NULL, so that enums and bitmasks without any option still have a valid table.
+// The structs have no table, their dumpers are generated per backend.
+
+struct ApiDumpEnumOption {
+    int64_t value;
+    const char *name;
+};
+
+struct ApiDumpBitmaskOption {
+    uint64_t value;
+    const char *name;
+    bool match_value;  // The option is set only when all the bits of the bitmask match, rather than any of them
+};
+
+// Enum options are sorted by value by the generator. Returns NULL when the value isn't part of the enum.
+template <size_t N>
+inline const char *find_enum_option(const ApiDumpEnumOption (&options)[N], int64_t value) {
+    const ApiDumpEnumOption *end = options + (N - 1);
+    const ApiDumpEnumOption *it =
+        std::lower_bound(options, end, value, [](const ApiDumpEnumOption &option, int64_t key) { return option.value < key; });
+    return it != end && it->value == value ? it->name : NULL;
+}
+
+// Calls the backend bitmaskOption function for each option set in the bitmask. Returns false if any option was written.
+template <size_t N>
+inline bool dump_bitmask_options(const ApiDumpBitmaskOption (&options)[N], uint64_t object, std::ostream &stream,
+                                 bool (*dump_option)(const std::string &, std::ostream &, bool)) {
+    bool is_first = true;
+    for (size_t i = 0; i < N - 1; ++i) {
+        if (options[i].match_value ? object == options[i].value : (object & options[i].value) != 0)
+            is_first = dump_option(options[i].name, stream, is_first);
+    }
+    return is_first;
+}
+
 //==================================== Text Backend Helpers ======================================//
 
 template <typename T, typename... Args>
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 Valve Corporation
+# Copyright (c) 2021 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Extract a range of frames from an api_dump output file, using the frame index written by the layer
+# when lunarg_api_dump.frame_index or VK_APIDUMP_FRAME_INDEX is enabled. The index is the output file
+# name followed by ".idx". Only the extracted frames are read from the output file.
+#
+# The html and json outputs keep the header and the footer of the file, so the extracted frames are a
+# valid document, including when the dump was interrupted before the layer wrote the footer.
+#
+# Usage: apidump-slice.py <inputfile> <first_frame> [<last_frame>] [-o <outputfile>]
+#
+# The extracted frames are output to stdout unless an output file is given.
+
+import argparse
+import sys
+
+FOOTERS = {
+    'html': b'</div></body></html>',
+    'json': b'\n]\n',
+}
+
+# The last frame of an interrupted dump is still open, it's closed like closeFrameOutput in api_dump.h does
+FRAME_CLOSINGS = {
+    'html': b'</details>',
+    'json': b'\n]\n}',
+}
+
+CHUNK_SIZE = 1 << 20
+
+def LoadIndex(index_path):
+    output_format = 'text'
+    frames = []
+    end = None
+    with open(index_path, 'r') as index_file:
+        for line in index_file:
+            tokens = line.split()
+            if len(tokens) == 2 and tokens[0] == 'format':
+                output_format = tokens[1]
+            elif len(tokens) == 3 and tokens[0] == 'frame':
+                frames.append((int(tokens[1]), int(tokens[2])))
+            elif len(tokens) == 2 and tokens[0] == 'end':
+                end = int(tokens[1])
+    return output_format, frames, end
+
+def CopyRange(input_file, output_file, begin, end):
+    input_file.seek(begin)
+    remaining = end - begin
+    while remaining > 0:
+        chunk = input_file.read(min(CHUNK_SIZE, remaining))
+        if not chunk:
+            break
+        output_file.write(chunk)
+        remaining -= len(chunk)
+
+def Slice(input_path, output_file, first_frame, last_frame):
+    output_format, frames, end = LoadIndex(input_path + '.idx')
+    if not frames:
+        print('No frame indexed in %s.idx' % input_path, file=sys.stderr)
+        return 1
+
+    selected = [i for i, (frame, _) in enumerate(frames) if first_frame <= frame <= last_frame]
+    if not selected:
+        print('No indexed frame in the range %d-%d' % (first_frame, last_frame), file=sys.stderr)
+        return 1
+
+    with open(input_path, 'rb') as input_file:
+        input_file.seek(0, 2)
+        file_size = input_file.tell()
+        content_end = end if end is not None else file_size
+
+        last_frame_selected = selected[-1] + 1 == len(frames)
+        begin = frames[selected[0]][1]
+        stop = content_end if last_frame_selected else frames[selected[-1] + 1][1]
+
+        # Everything before the first indexed frame is the header of the file
+        CopyRange(input_file, output_file, 0, frames[0][1])
+
+        if output_format == 'json':
+            # The separator of the next frame follows the last frame
+            input_file.seek(begin)
+            body = input_file.read(stop - begin).rstrip()
+            output_file.write(body[:-1] if body.endswith(b',') else body)
+        else:
+            CopyRange(input_file, output_file, begin, stop)
+
+        # A dump without an end entry was interrupted, its last frame is open and it has no footer
+        if end is not None:
+            CopyRange(input_file, output_file, end, file_size)
+        else:
+            if last_frame_selected and output_format in FRAME_CLOSINGS:
+                output_file.write(FRAME_CLOSINGS[output_format])
+            if output_format in FOOTERS:
+                output_file.write(FOOTERS[output_format])
+    return 0
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Extract a range of frames from an api_dump output file using its frame index.')
+    parser.add_argument('input', help='api_dump output file, with its frame index in <input>.idx')
+    parser.add_argument('first_frame', type=int, help='first frame to extract')
+    parser.add_argument('last_frame', type=int, nargs='?', help='last frame to extract, the first frame by default')
+    parser.add_argument('-o', '--output', help='output file, stdout by default')
+    args = parser.parse_args(argv)
+
+    last_frame = args.first_frame if args.last_frame is None else args.last_frame
+
+    if args.output is None:
+        return Slice(args.input, sys.stdout.buffer, args.first_frame, last_frame)
+    with open(args.output, 'wb') as output_file:
+        return Slice(args.input, output_file, args.first_frame, last_frame)
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -81,6 +81,24 @@ static struct {
 static std::unordered_map<VkPhysicalDevice, VkInstance> layer_instances;
 static std::unordered_map<void *, monitor_layer_data *> layer_data_map;
 
+// Commands the layer calls down the chain, the other dispatch table entries are never resolved
+static const dispatch_table_entry device_dispatch_entries[] = {
+    DEVICE_DISPATCH_TABLE_ENTRY(DestroyDevice),
+    DEVICE_DISPATCH_TABLE_ENTRY(DeviceWaitIdle),
+};
+
+static const dispatch_table_entry instance_dispatch_entries[] = {
+    INSTANCE_DISPATCH_TABLE_ENTRY(DestroyInstance),
+    INSTANCE_DISPATCH_TABLE_ENTRY(EnumeratePhysicalDevices),
+    INSTANCE_DISPATCH_TABLE_ENTRY(EnumeratePhysicalDeviceGroups),
+    INSTANCE_DISPATCH_TABLE_ENTRY(GetPhysicalDeviceToolPropertiesEXT),
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    INSTANCE_DISPATCH_TABLE_ENTRY(CreateWin32SurfaceKHR),
+#elif defined(VK_USE_PLATFORM_XCB_KHR)
+    INSTANCE_DISPATCH_TABLE_ENTRY(CreateXcbSurfaceKHR),
+#endif
+};
+
 template monitor_layer_data *GetLayerDataPtr<monitor_layer_data>(void *data_key,
                                                                  std::unordered_map<void *, monitor_layer_data *> &data_map);
 
@@ -108,7 +126,9 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDevice(VkPhysicalDevice g
 
     // Setup device dispatch table
     my_device_data->device_dispatch_table = new VkLayerDispatchTable;
-    layer_init_device_dispatch_table(*pDevice, my_device_data->device_dispatch_table, fpGetDeviceProcAddr);
+    init_device_dispatch_table_entries(*pDevice, my_device_data->device_dispatch_table, fpGetDeviceProcAddr,
+                                       device_dispatch_entries,
+                                       sizeof(device_dispatch_entries) / sizeof(device_dispatch_entries[0]));
 
     // store the loader callback for initializing created dispatchable objects
     chain_info = get_chain_info(pCreateInfo, VK_LOADER_DATA_CALLBACK);
@@ -201,7 +221,9 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstance
 
     monitor_layer_data *my_data = GetLayerDataPtr(get_dispatch_key(*pInstance), layer_data_map);
     my_data->instance_dispatch_table = new VkLayerInstanceDispatchTable;
-    layer_init_instance_dispatch_table(*pInstance, my_data->instance_dispatch_table, fpGetInstanceProcAddr);
+    init_instance_dispatch_table_entries(*pInstance, my_data->instance_dispatch_table, fpGetInstanceProcAddr,
+                                         instance_dispatch_entries,
+                                         sizeof(instance_dispatch_entries) / sizeof(instance_dispatch_entries[0]));
 
 #if defined(VK_USE_PLATFORM_XCB_KHR)
     // Initialize connection to null in case vkCreateXcbSurfaceKHR is never called
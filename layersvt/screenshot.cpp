@@ -176,6 +176,37 @@ typedef struct {
 } PhysDeviceMapStruct;
 static unordered_map<VkPhysicalDevice, PhysDeviceMapStruct *> physDeviceMap;
 
+// Commands the layer calls down the chain, the other device dispatch table entries are never resolved
+static const dispatch_table_entry device_dispatch_entries[] = {
+    DEVICE_DISPATCH_TABLE_ENTRY(AcquireNextImageKHR),
+    DEVICE_DISPATCH_TABLE_ENTRY(AllocateCommandBuffers),
+    DEVICE_DISPATCH_TABLE_ENTRY(AllocateMemory),
+    DEVICE_DISPATCH_TABLE_ENTRY(BeginCommandBuffer),
+    DEVICE_DISPATCH_TABLE_ENTRY(BindImageMemory),
+    DEVICE_DISPATCH_TABLE_ENTRY(CmdBlitImage),
+    DEVICE_DISPATCH_TABLE_ENTRY(CmdCopyImage),
+    DEVICE_DISPATCH_TABLE_ENTRY(CmdPipelineBarrier),
+    DEVICE_DISPATCH_TABLE_ENTRY(CreateCommandPool),
+    DEVICE_DISPATCH_TABLE_ENTRY(CreateImage),
+    DEVICE_DISPATCH_TABLE_ENTRY(CreateSwapchainKHR),
+    DEVICE_DISPATCH_TABLE_ENTRY(DestroyCommandPool),
+    DEVICE_DISPATCH_TABLE_ENTRY(DestroyDevice),
+    DEVICE_DISPATCH_TABLE_ENTRY(DestroyImage),
+    DEVICE_DISPATCH_TABLE_ENTRY(DeviceWaitIdle),
+    DEVICE_DISPATCH_TABLE_ENTRY(EndCommandBuffer),
+    DEVICE_DISPATCH_TABLE_ENTRY(FreeCommandBuffers),
+    DEVICE_DISPATCH_TABLE_ENTRY(FreeMemory),
+    DEVICE_DISPATCH_TABLE_ENTRY(GetDeviceQueue),
+    DEVICE_DISPATCH_TABLE_ENTRY(GetImageMemoryRequirements),
+    DEVICE_DISPATCH_TABLE_ENTRY(GetImageSubresourceLayout),
+    DEVICE_DISPATCH_TABLE_ENTRY(GetSwapchainImagesKHR),
+    DEVICE_DISPATCH_TABLE_ENTRY(MapMemory),
+    DEVICE_DISPATCH_TABLE_ENTRY(QueuePresentKHR),
+    DEVICE_DISPATCH_TABLE_ENTRY(QueueSubmit),
+    DEVICE_DISPATCH_TABLE_ENTRY(QueueWaitIdle),
+    DEVICE_DISPATCH_TABLE_ENTRY(UnmapMemory),
+};
+
 // set: list of frames to take screenshots without duplication.
 static set<int> screenshotFrames;
 
@@ -1158,7 +1189,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     // Setup device dispatch table
     dispatchMapElem->device_dispatch_table = new VkLayerDispatchTable;
-    layer_init_device_dispatch_table(*pDevice, dispatchMapElem->device_dispatch_table, fpGetDeviceProcAddr);
+    init_device_dispatch_table_entries(*pDevice, dispatchMapElem->device_dispatch_table, fpGetDeviceProcAddr,
+                                       device_dispatch_entries,
+                                       sizeof(device_dispatch_entries) / sizeof(device_dispatch_entries[0]));
 
     createDeviceRegisterExtensions(pCreateInfo, *pDevice);
     // Create a mapping from a device to a physicalDevice
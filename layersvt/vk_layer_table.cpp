@@ -18,6 +18,7 @@
  * Author: Tobin Ehlis <tobin@lunarg.com>
  */
 #include <assert.h>
+#include <string.h>
 #include <unordered_map>
 #include "vk_dispatch_table_helper.h"
 #include "vulkan/vk_layer.h"
@@ -144,3 +145,28 @@ VkLayerDispatchTable *initDeviceTable(VkDevice device, const PFN_vkGetDeviceProc
 VkLayerDispatchTable *initDeviceTable(VkDevice device, const PFN_vkGetDeviceProcAddr gpa) {
     return initDeviceTable(device, gpa, tableMap);
 }
+
+void init_device_dispatch_table_entries(VkDevice device, VkLayerDispatchTable *table, PFN_vkGetDeviceProcAddr gpa,
+                                        const dispatch_table_entry *entries, size_t entry_count) {
+    memset(table, 0, sizeof(VkLayerDispatchTable));
+
+    for (size_t i = 0; i < entry_count; ++i) {
+        assert(entries[i].offset + sizeof(PFN_vkVoidFunction) <= sizeof(VkLayerDispatchTable));
+        *reinterpret_cast<PFN_vkVoidFunction *>(reinterpret_cast<char *>(table) + entries[i].offset) = gpa(device, entries[i].name);
+    }
+
+    table->GetDeviceProcAddr = gpa;
+}
+
+void init_instance_dispatch_table_entries(VkInstance instance, VkLayerInstanceDispatchTable *table, PFN_vkGetInstanceProcAddr gpa,
+                                          const dispatch_table_entry *entries, size_t entry_count) {
+    memset(table, 0, sizeof(VkLayerInstanceDispatchTable));
+
+    for (size_t i = 0; i < entry_count; ++i) {
+        assert(entries[i].offset + sizeof(PFN_vkVoidFunction) <= sizeof(VkLayerInstanceDispatchTable));
+        *reinterpret_cast<PFN_vkVoidFunction *>(reinterpret_cast<char *>(table) + entries[i].offset) =
+            gpa(instance, entries[i].name);
+    }
+
+    table->GetInstanceProcAddr = gpa;
+}
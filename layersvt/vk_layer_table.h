@@ -22,6 +22,7 @@
 #include "vulkan/vk_layer.h"
 #include "vulkan/vulkan.h"
 #include <unordered_map>
+#include <cstddef>
 #include "vk_layer_utils.h"
 
 typedef std::unordered_map<void *, VkLayerDispatchTable *> device_table_map;
@@ -31,6 +32,24 @@ VkLayerDispatchTable *initDeviceTable(VkDevice device, const PFN_vkGetDeviceProc
 VkLayerInstanceDispatchTable *initInstanceTable(VkInstance instance, const PFN_vkGetInstanceProcAddr gpa, instance_table_map &map);
 VkLayerInstanceDispatchTable *initInstanceTable(VkInstance instance, const PFN_vkGetInstanceProcAddr gpa);
 
+// Dispatch table entry resolved by name, for layers that only call a few commands down the chain
+struct dispatch_table_entry {
+    const char *name;
+    size_t offset;
+};
+
+#define DEVICE_DISPATCH_TABLE_ENTRY(command) \
+    { "vk" #command, offsetof(VkLayerDispatchTable, command) }
+#define INSTANCE_DISPATCH_TABLE_ENTRY(command) \
+    { "vk" #command, offsetof(VkLayerInstanceDispatchTable, command) }
+
+// Only resolve the listed entries, the other entries are null. Filling the full table calls the next GetDeviceProcAddr or
+// GetInstanceProcAddr for each command of the registry, on each vkCreateDevice and vkCreateInstance.
+void init_device_dispatch_table_entries(VkDevice device, VkLayerDispatchTable *table, PFN_vkGetDeviceProcAddr gpa,
+                                        const dispatch_table_entry *entries, size_t entry_count);
+void init_instance_dispatch_table_entries(VkInstance instance, VkLayerInstanceDispatchTable *table, PFN_vkGetInstanceProcAddr gpa,
+                                          const dispatch_table_entry *entries, size_t entry_count);
+
 typedef void *dispatch_key;
 
 VkLayerDispatchTable *device_dispatch_table(void *object);
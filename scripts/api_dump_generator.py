@@ -78,11 +78,56 @@ COMMON_CODEGEN = """
 
 //============================= Dump Functions ==============================//
 
+// With aggregate_cmd_buffers, the commands recorded in the submitted command buffers are written as one block before
+// vkQueueSubmit, vkQueueSubmit2 and vkQueueSubmit2KHR
+inline void dump_cmd_buffer_records(ApiDumpInstance& dump_inst, VkCommandBuffer commandBuffer)
+{{
+    for (const std::string& record : dump_inst.getCmdBufferRecords(commandBuffer)) {{
+        if (dump_inst.settings().format() == ApiDumpFormat::Json)
+            dump_json_function_separator(dump_inst);
+        dump_inst.settings().writeRecord(record);
+    }}
+}}
+
+inline void dump_submitted_cmd_buffers(ApiDumpInstance& dump_inst, uint32_t submitCount, const VkSubmitInfo* pSubmits)
+{{
+    if (!dump_inst.settings().aggregateCmdBuffers() || pSubmits == NULL) return;
+
+    for (uint32_t i = 0; i < submitCount; ++i) {{
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferCount; ++j) {{
+            dump_cmd_buffer_records(dump_inst, pSubmits[i].pCommandBuffers[j]);
+        }}
+    }}
+}}
+
+// A template so that it builds with the headers defining only VkSubmitInfo2KHR as well as with the headers defining VkSubmitInfo2
+template <typename SubmitInfo2>
+inline void dump_submitted_cmd_buffers2(ApiDumpInstance& dump_inst, uint32_t submitCount, const SubmitInfo2* pSubmits)
+{{
+    if (!dump_inst.settings().aggregateCmdBuffers() || pSubmits == NULL) return;
+
+    for (uint32_t i = 0; i < submitCount; ++i) {{
+        if (pSubmits[i].pCommandBufferInfos == NULL) continue;
+        for (uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; ++j) {{
+            dump_cmd_buffer_records(dump_inst, pSubmits[i].pCommandBufferInfos[j].commandBuffer);
+        }}
+    }}
+}}
+
 @foreach function where(not '{funcName}' in ['vkGetDeviceProcAddr', 'vkGetInstanceProcAddr', 'vkDebugMarkerSetObjectNameEXT','vkSetDebugUtilsObjectNameEXT'])
 inline void dump_head_{funcName}(ApiDumpInstance& dump_inst, {funcTypedParams})
 {{
     if (!dump_inst.shouldDumpOutput()) return ;
     dump_inst.outputMutex()->lock();
+    @if('{funcName}' == 'vkQueueSubmit')
+    dump_submitted_cmd_buffers(dump_inst, submitCount, pSubmits);
+    @end if
+    @if('{funcName}' in ['vkQueueSubmit2', 'vkQueueSubmit2KHR'])
+    dump_submitted_cmd_buffers2(dump_inst, submitCount, pSubmits);
+    @end if
+    @if('{funcName}'.startswith('vkCmd') or '{funcName}' in ['vkBeginCommandBuffer', 'vkEndCommandBuffer'])
+    dump_inst.beginCmdBufferRecord();
+    @end if
     switch(dump_inst.settings().format())
     {{
     case ApiDumpFormat::Text:
@@ -92,6 +137,7 @@ inline void dump_head_{funcName}(ApiDumpInstance& dump_inst, {funcTypedParams})
         dump_html_head_{funcName}(dump_inst, {funcNamedParams});
         break;
     case ApiDumpFormat::Json:
+    case ApiDumpFormat::Ndjson:
         dump_json_head_{funcName}(dump_inst, {funcNamedParams});
         break;
     }}
@@ -114,9 +160,19 @@ inline void dump_body_{funcName}(ApiDumpInstance& dump_inst, {funcReturn} result
         dump_html_body_{funcName}(dump_inst, result, {funcNamedParams});
         break;
     case ApiDumpFormat::Json:
+    case ApiDumpFormat::Ndjson:
         dump_json_body_{funcName}(dump_inst, result, {funcNamedParams});
         break;
     }}
+    @if('{funcName}'.startswith('vkCmd') or '{funcName}' in ['vkBeginCommandBuffer', 'vkEndCommandBuffer'])
+    dump_inst.endCmdBufferRecord(commandBuffer);
+    @end if
+    @if('{funcName}' == 'vkCmdExecuteCommands')
+    dump_inst.executeCmdBufferRecords(commandBuffer, commandBufferCount, pCommandBuffers);
+    @end if
+    @if('{funcName}' != 'vkQueuePresentKHR')
+    dump_inst.rotateOutputFileAfterCall();
+    @end if
     dump_inst.outputMutex()->unlock();
 }}
 @end function
@@ -135,9 +191,19 @@ inline void dump_body_{funcName}(ApiDumpInstance& dump_inst, {funcTypedParams})
         dump_html_body_{funcName}(dump_inst, {funcNamedParams});
         break;
     case ApiDumpFormat::Json:
+    case ApiDumpFormat::Ndjson:
         dump_json_body_{funcName}(dump_inst, {funcNamedParams});
         break;
     }}
+    @if('{funcName}'.startswith('vkCmd') or '{funcName}' in ['vkBeginCommandBuffer', 'vkEndCommandBuffer'])
+    dump_inst.endCmdBufferRecord(commandBuffer);
+    @end if
+    @if('{funcName}' == 'vkCmdExecuteCommands')
+    dump_inst.executeCmdBufferRecords(commandBuffer, commandBufferCount, pCommandBuffers);
+    @end if
+    @if('{funcName}' != 'vkQueuePresentKHR')
+    dump_inst.rotateOutputFileAfterCall();
+    @end if
     dump_inst.outputMutex()->unlock();
 }}
 @end function
@@ -167,6 +233,7 @@ inline void dump_head_{funcName}(ApiDumpInstance& dump_inst, {funcTypedParams})
             dump_html_head_{funcName}(dump_inst, {funcNamedParams});
             break;
         case ApiDumpFormat::Json:
+        case ApiDumpFormat::Ndjson:
             dump_json_head_{funcName}(dump_inst, {funcNamedParams});
             break;
         }}
@@ -190,9 +257,11 @@ inline void dump_body_{funcName}(ApiDumpInstance& dump_inst, {funcReturn} result
             dump_html_body_{funcName}(dump_inst, result, {funcNamedParams});
             break;
         case ApiDumpFormat::Json:
+        case ApiDumpFormat::Ndjson:
             dump_json_body_{funcName}(dump_inst, result, {funcNamedParams});
             break;
         }}
+        dump_inst.rotateOutputFileAfterCall();
     }}
 
     dump_inst.outputMutex()->unlock();
@@ -221,6 +290,7 @@ inline void dump_head_{funcName}(ApiDumpInstance& dump_inst, {funcTypedParams})
             dump_html_head_{funcName}(dump_inst, {funcNamedParams});
             break;
         case ApiDumpFormat::Json:
+        case ApiDumpFormat::Ndjson:
             dump_json_head_{funcName}(dump_inst, {funcNamedParams});
             break;
         }}
@@ -243,9 +313,11 @@ inline void dump_body_{funcName}(ApiDumpInstance& dump_inst, {funcReturn} result
             dump_html_body_{funcName}(dump_inst, result, {funcNamedParams});
             break;
         case ApiDumpFormat::Json:
+        case ApiDumpFormat::Ndjson:
             dump_json_body_{funcName}(dump_inst, result, {funcNamedParams});
             break;
         }}
+        dump_inst.rotateOutputFileAfterCall();
     }}
     dump_inst.outputMutex()->unlock();
 }}
@@ -692,21 +764,42 @@ inline std::ostream& dump_text_{hdlName}(const {hdlName} object, const ApiDumpSe
 }}
 @end handle
 
+//========================== Enum and Bitmask Tables ========================//
+
+// NOTE: Because all of the api_dump_*.h files are only included in api_dump.cpp, the enum and bitmask
+// tables only need to be generated by the first .h file. The html and json backends use them too.
+// Only enums and bitmasks are table driven, the structs dumpers are still generated per backend.
+
+@foreach enum
+static const ApiDumpEnumOption enum_options_{enumName}[] = {{
+    @foreach option
+    {{{optValue}, "{optName}"}},
+    @end option
+    {{0, NULL}}
+}};
+@end enum
+
+@foreach bitmask
+static const ApiDumpBitmaskOption bitmask_options_{bitName}[] = {{
+    @foreach option
+        @if('{optMultiValue}' != 'None')
+    {{{optValue}, "{optName}", true}},
+        @end if
+        @if('{optMultiValue}' == 'None')
+    {{{optValue}, "{optName}", false}},
+        @end if
+    @end option
+    {{0, NULL, false}}
+}};
+@end bitmask
+
 //=========================== Enum Implementations ==========================//
 
 @foreach enum
 std::ostream& dump_text_{enumName}({enumName} object, const ApiDumpSettings& settings, int indents)
 {{
-    switch((int64_t) object)
-    {{
-    @foreach option
-    case {optValue}:
-        settings.stream() << "{optName} (";
-        break;
-    @end option
-    default:
-        settings.stream() << "UNKNOWN (";
-    }}
+    const char* name = find_enum_option(enum_options_{enumName}, (int64_t) object);
+    settings.stream() << (name != NULL ? name : "UNKNOWN") << " (";
     return settings.stream() << object << ")";
 }}
 @end enum
@@ -722,20 +815,8 @@ typedef VkFlags64 {bitName};
 @end if
 std::ostream& dump_text_{bitName}({bitName} object, const ApiDumpSettings& settings, int indents)
 {{
-    bool is_first = true;
-    //settings.formatNameType(stream, indents, name, type_string) << object;
     settings.stream() << object;
-    @foreach option
-        @if('{optMultiValue}' != 'None')
-            if(object == {optValue})
-                is_first = dump_text_bitmaskOption("{optName}", settings.stream(), is_first);
-        @end if
-        @if('{optMultiValue}' == 'None')
-            if(object & {optValue})
-                is_first = dump_text_bitmaskOption("{optName}", settings.stream(), is_first);
-        @end if
-
-    @end option
+    bool is_first = dump_bitmask_options(bitmask_options_{bitName}, object, settings.stream(), dump_text_bitmaskOption);
     if(!is_first)
         settings.stream() << ")";
     return settings.stream();
@@ -1136,16 +1217,8 @@ inline std::ostream& dump_html_{hdlName}(const {hdlName} object, const ApiDumpSe
 std::ostream& dump_html_{enumName}({enumName} object, const ApiDumpSettings& settings, int indents)
 {{
     settings.stream() << "<div class='val'>";
-    switch((int64_t) object)
-    {{
-    @foreach option
-    case {optValue}:
-        settings.stream() << "{optName} (";
-        break;
-    @end option
-    default:
-        settings.stream() << "UNKNOWN (";
-    }}
+    const char* name = find_enum_option(enum_options_{enumName}, (int64_t) object);
+    settings.stream() << (name != NULL ? name : "UNKNOWN") << " (";
     return settings.stream() << object << ")</div></summary>";
 }}
 @end enum
@@ -1156,18 +1229,8 @@ std::ostream& dump_html_{enumName}({enumName} object, const ApiDumpSettings& set
 std::ostream& dump_html_{bitName}({bitName} object, const ApiDumpSettings& settings, int indents)
 {{
     settings.stream() << "<div class=\'val\'>";
-    bool is_first = true;
     settings.stream() << object;
-    @foreach option
-        @if('{optMultiValue}' != 'None')
-            if(object == {optValue})
-                is_first = dump_html_bitmaskOption("{optName}", settings.stream(), is_first);
-        @end if
-        @if('{optMultiValue}' == 'None')
-            if(object & {optValue})
-                is_first = dump_html_bitmaskOption("{optName}", settings.stream(), is_first);
-        @end if
-    @end option
+    bool is_first = dump_bitmask_options(bitmask_options_{bitName}, object, settings.stream(), dump_html_bitmaskOption);
     if(!is_first)
         settings.stream() << ")";
     return settings.stream() << "</div></summary>";
@@ -1556,16 +1619,11 @@ inline std::ostream& dump_json_{hdlName}(const {hdlName} object, const ApiDumpSe
 @foreach enum
 std::ostream& dump_json_{enumName}({enumName} object, const ApiDumpSettings& settings, int indents)
 {{
-    switch((int64_t) object)
-    {{
-    @foreach option
-    case {optValue}:
-        settings.stream() << "\\"{optName}\\"";
-        break;
-    @end option
-    default:
+    const char* name = find_enum_option(enum_options_{enumName}, (int64_t) object);
+    if (name != NULL)
+        settings.stream() << "\\"" << name << "\\"";
+    else
         settings.stream() << "\\"UNKNOWN (" << object << ")\\"";
-    }}
     return settings.stream();
 }}
 @end enum
@@ -1575,20 +1633,10 @@ std::ostream& dump_json_{enumName}({enumName} object, const ApiDumpSettings& set
 @foreach bitmask
 std::ostream& dump_json_{bitName}({bitName} object, const ApiDumpSettings& settings, int indents)
 {{
-    bool is_first = true;
     settings.stream() << '"' << object;
     if (object)
         settings.stream() << ' ';
-    @foreach option
-        @if('{optMultiValue}' != 'None')
-            if(object == {optValue})
-                is_first = dump_json_bitmaskOption("{optName}", settings.stream(), is_first);
-        @end if
-        @if('{optMultiValue}' == 'None')
-            if(object & {optValue})
-                is_first = dump_json_bitmaskOption("{optName}", settings.stream(), is_first);
-        @end if
-    @end option
+    bool is_first = dump_bitmask_options(bitmask_options_{bitName}, object, settings.stream(), dump_json_bitmaskOption);
     if(!is_first)
         settings.stream() << ')';
     return settings.stream() << "\\"";
@@ -1782,22 +1830,36 @@ bool is_union(const char *t)
 
 static bool needFuncComma = false;
 
-@foreach function where(not '{funcName}' in ['vkGetDeviceProcAddr', 'vkGetInstanceProcAddr'])
-std::ostream& dump_json_head_{funcName}(ApiDumpInstance& dump_inst, {funcTypedParams})
+inline void dump_json_function_separator(ApiDumpInstance& dump_inst)
 {{
     const ApiDumpSettings& settings(dump_inst.settings());
 
-    if(dump_inst.firstFunctionCallOnFrame())
+    const bool first_call_of_continued_frame = settings.firstCallOfContinuedFrame();
+    if(dump_inst.firstFunctionCallOnFrame() || first_call_of_continued_frame)
         needFuncComma = false;
 
-    if (needFuncComma) settings.stream() << ",\\n";
+    // Each Ndjson line is a complete object, without separator
+    if (needFuncComma && settings.format() == ApiDumpFormat::Json) settings.stream() << ",\\n";
+    needFuncComma = true;
+}}
+
+@foreach function where(not '{funcName}' in ['vkGetDeviceProcAddr', 'vkGetInstanceProcAddr'])
+std::ostream& dump_json_head_{funcName}(ApiDumpInstance& dump_inst, {funcTypedParams})
+{{
+    const ApiDumpSettings& settings(dump_inst.settings());
+
+    // A recorded command gets its separator when its command buffer is submitted
+    if (!settings.isCapturingRecord())
+        dump_json_function_separator(dump_inst);
 
     // Display apicall name
     settings.stream() << settings.indentation(2) << "{{\\n";
     settings.stream() << settings.indentation(3) << "\\\"name\\\" : \\\"{funcName}\\\",\\n";
 
-    // Display thread info
-    if (settings.showThreadAndFrame()){{
+    // Display thread info, an Ndjson line has no enclosing frame object so it always has its frame and thread
+    if (settings.showThreadAndFrame() || settings.format() == ApiDumpFormat::Ndjson){{
+        if (settings.format() == ApiDumpFormat::Ndjson)
+            settings.stream() << "\\\"frameNumber\\\" : \\\"" << dump_inst.frameCount() << "\\\",\\n";
         settings.stream() << settings.indentation(3) << "\\\"thread\\\" : \\\"Thread " << dump_inst.threadID() << "\\\",\\n";
     }}
 
@@ -1856,8 +1918,10 @@ std::ostream& dump_json_body_{funcName}(ApiDumpInstance& dump_inst, {funcTypedPa
         settings.stream() << "\\n" << settings.indentation(3) << "]\\n";
     }}
     settings.stream() << settings.indentation(2) << "}}";
-    needFuncComma = true;
-    if (settings.shouldFlush()) settings.stream().flush();
+    if (settings.format() == ApiDumpFormat::Ndjson)
+        settings.writeLine();
+    else if (settings.shouldFlush())
+        settings.stream().flush();
     return settings.stream();
 }}
 @end function
@@ -1880,6 +1944,15 @@ TRACKED_STATE = {
     'vkFreeCommandBuffers':
         'ApiDumpInstance::current().eraseCmdBuffers(device, commandPool, std::vector<VkCommandBuffer>(pCommandBuffers, pCommandBuffers + commandBufferCount));'
     ,
+    'vkBeginCommandBuffer':
+        'ApiDumpInstance::current().resetCmdBufferRecords(commandBuffer);'
+    ,
+    'vkResetCommandBuffer':
+        'ApiDumpInstance::current().resetCmdBufferRecords(commandBuffer);'
+    ,
+    'vkResetCommandPool':
+        'ApiDumpInstance::current().resetCmdBufferPoolRecords(device, commandPool);'
+    ,
 }
 
 INHERITED_STATE = {
@@ -2555,6 +2628,9 @@ class VulkanEnum:
                     continue
                 self.options.append(VulkanEnum.Option(childName, childValue, None, None))
 
+        # The enum reflection tables are searched by value
+        self.options.sort(key=lambda option: StrToInt(str(option.value)))
+
     def values(self):
         return {
             'enumName': self.name,
@@ -123,6 +123,8 @@ def RunVTTests(args):
     RunATest(vt_cmd, vt_env)
     vt_cmd = '%s/tests/apidump_test.sh -t %s/Vulkan-Tools/%s' % (BUILD_DIR_NAME, EXTERNAL_DIR, BUILD_DIR_NAME)
     RunATest(vt_cmd, vt_env)
+    vt_cmd = '%s/tests/startup_benchmark.sh -t %s/Vulkan-Tools/%s' % (BUILD_DIR_NAME, EXTERNAL_DIR, BUILD_DIR_NAME)
+    RunATest(vt_cmd, vt_env)
 
 #
 # Module Entrypoint
@@ -0,0 +1,197 @@
+#!/usr/bin/python3
+#
+# Copyright (c) 2020-2021 Valve Corporation
+# Copyright (c) 2020-2021 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Author: Christophe Riccio <christophe@lunarg.com>
+
+# Convert the Vulkan Configurator built-in layers manifests and configurations to CBOR so that they are decoded with
+# QCborValue at runtime instead of being parsed as JSON text. Without JSON text, the built-in layers manifests are not
+# validated at runtime, they are validated here against the layers schema instead.
+#
+# Usage: vkconfig_builtin_generator.py [--schema <layers_schema.json>] <output.cpp> <resource_path> <json_file> [...]
+
+import json
+import re
+import struct
+import sys
+
+# The built-in layers manifests older than 1.2.170 predate the layers schema, like in Layer::LoadFeatures
+SCHEMA_API_VERSION = (1, 2, 170)
+
+JSON_TYPES = {
+    'object': lambda value: isinstance(value, dict),
+    'array': lambda value: isinstance(value, list),
+    'string': lambda value: isinstance(value, str),
+    'boolean': lambda value: isinstance(value, bool),
+    'integer': lambda value: isinstance(value, int) and not isinstance(value, bool),
+    'number': lambda value: isinstance(value, (int, float)) and not isinstance(value, bool),
+    'null': lambda value: value is None,
+}
+
+# Only the JSON schema keywords used by the layers schema are checked
+def Validate(value, schema, root, path):
+    if '$ref' in schema:
+        node = root
+        for name in schema['$ref'].lstrip('#/').split('/'):
+            node = node[name]
+        return Validate(value, node, root, path)
+
+    if 'type' in schema:
+        types = schema['type'] if isinstance(schema['type'], list) else [schema['type']]
+        if not any(JSON_TYPES[name](value) for name in types):
+            return '%s: %r is not of type %s' % (path, value, ' or '.join(types))
+    if 'enum' in schema and value not in schema['enum']:
+        return '%s: %r is not one of %r' % (path, value, schema['enum'])
+    if 'pattern' in schema and isinstance(value, str) and re.search(schema['pattern'], value) is None:
+        return '%s: %r does not match %r' % (path, value, schema['pattern'])
+
+    if 'oneOf' in schema:
+        matches = [Validate(value, option, root, path) is None for option in schema['oneOf']].count(True)
+        if matches != 1:
+            return '%s: %d of the oneOf schemas match instead of 1' % (path, matches)
+
+    if isinstance(value, dict):
+        for name in schema.get('required', []):
+            if name not in value:
+                return '%s: "%s" is required' % (path, name)
+
+        properties = schema.get('properties', {})
+        additional = schema.get('additionalProperties', True)
+        for name, element in value.items():
+            if name in properties:
+                error = Validate(element, properties[name], root, '%s.%s' % (path, name))
+            elif additional is False:
+                error = '%s: "%s" is not allowed' % (path, name)
+            elif isinstance(additional, dict):
+                error = Validate(element, additional, root, '%s.%s' % (path, name))
+            else:
+                error = None
+            if error is not None:
+                return error
+
+    if isinstance(value, list):
+        if isinstance(schema.get('items'), dict):
+            for index, element in enumerate(value):
+                error = Validate(element, schema['items'], root, '%s[%d]' % (path, index))
+                if error is not None:
+                    return error
+        if schema.get('uniqueItems', False):
+            elements = [json.dumps(element, sort_keys=True) for element in value]
+            if len(set(elements)) != len(elements):
+                return '%s: the elements are not unique' % path
+        if 'contains' in schema and not any(Validate(element, schema['contains'], root, path) is None for element in value):
+            return '%s: no element matches the contains schema' % path
+
+    return None
+
+def ShouldValidate(resource_path, document):
+    if not resource_path.startswith(':/layers/'):
+        return False
+    api_version = document.get('layer', {}).get('api_version', '0.0.0')
+    return tuple(int(number) for number in api_version.split('.')) >= SCHEMA_API_VERSION
+
+def EncodeHead(major, value):
+    if value < 24:
+        return bytes([(major << 5) | value])
+    if value < 0x100:
+        return bytes([(major << 5) | 24, value])
+    if value < 0x10000:
+        return bytes([(major << 5) | 25]) + struct.pack('>H', value)
+    if value < 0x100000000:
+        return bytes([(major << 5) | 26]) + struct.pack('>I', value)
+    return bytes([(major << 5) | 27]) + struct.pack('>Q', value)
+
+def EncodeCbor(value):
+    if value is None:
+        return bytes([0xf6])
+    if value is True:
+        return bytes([0xf5])
+    if value is False:
+        return bytes([0xf4])
+    if isinstance(value, int):
+        return EncodeHead(0, value) if value >= 0 else EncodeHead(1, -1 - value)
+    if isinstance(value, float):
+        return bytes([0xfb]) + struct.pack('>d', value)
+    if isinstance(value, str):
+        data = value.encode('utf-8')
+        return EncodeHead(3, len(data)) + data
+    if isinstance(value, list):
+        return EncodeHead(4, len(value)) + b''.join(EncodeCbor(element) for element in value)
+    if isinstance(value, dict):
+        return EncodeHead(5, len(value)) + b''.join(EncodeCbor(key) + EncodeCbor(element) for key, element in value.items())
+    raise TypeError('Unsupported JSON value: %r' % value)
+
+def GenerateSource(files, schema):
+    lines = []
+    lines.append('// *** THIS FILE IS GENERATED - DO NOT EDIT ***')
+    lines.append('// See vkconfig_builtin_generator.py for modifications')
+    lines.append('')
+    lines.append('#include "builtin.h"')
+    lines.append('')
+
+    # Sorted by resource path for the lookup by binary search
+    files = sorted(files)
+    for index, (resource_path, json_file) in enumerate(files):
+        with open(json_file, 'r', encoding='utf-8') as file:
+            document = json.load(file)
+
+        if schema is not None and ShouldValidate(resource_path, document):
+            error = Validate(document, schema, schema, '')
+            if error is not None:
+                raise ValueError('%s is not a valid layer manifest: %s' % (json_file, error))
+
+        data = EncodeCbor(document)
+
+        lines.append('// %s' % resource_path)
+        lines.append('static const unsigned char BUILTIN_DATA_%d[] = {' % index)
+        for offset in range(0, len(data), 16):
+            lines.append('    ' + ', '.join('0x%02x' % byte for byte in data[offset:offset + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+
+    lines.append('extern const BuiltinFile BUILTIN_FILES[] = {')
+    for index, (resource_path, json_file) in enumerate(files):
+        lines.append('    {"%s", BUILTIN_DATA_%d, sizeof(BUILTIN_DATA_%d)},' % (resource_path, index, index))
+    lines.append('};')
+    lines.append('')
+    lines.append('extern const std::size_t BUILTIN_FILE_COUNT = %d;' % len(files))
+    lines.append('')
+    return '\n'.join(lines)
+
+def main(argv):
+    schema = None
+    if len(argv) >= 2 and argv[0] == '--schema':
+        with open(argv[1], 'r', encoding='utf-8') as file:
+            schema = json.load(file)
+        argv = argv[2:]
+
+    if len(argv) < 3 or len(argv) % 2 != 1:
+        print('Usage: vkconfig_builtin_generator.py [--schema <layers_schema.json>] <output.cpp> <resource_path> <json_file> [...]')
+        return 1
+
+    files = [(argv[i], argv[i + 1]) for i in range(1, len(argv), 2)]
+    try:
+        source = GenerateSource(files, schema)
+    except ValueError as error:
+        print(error)
+        return 1
+
+    with open(argv[0], 'w', encoding='utf-8', newline='\n') as file:
+        file.write(source)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,151 @@
+#!/bin/bash
+
+# apidump_slice_test.sh
+# This script will write api_dump outputs with their frame index, like the api_dump layer does with
+# lunarg_api_dump.frame_index enabled, and extract frames from them with layersvt/apidump-slice.py.
+# The outputs are complete or cut short after the last frame started, as when the application crashed.
+# If each extracted json document parses with the expected frames and each extracted html document
+# has its details and the footer closed, the test will indicate PASS, else FAILURE. This script only
+# requires python3.
+
+if [ -t 1 ] ; then
+    RED='\033[0;31m'
+    GREEN='\033[0;32m'
+    NC='\033[0m' # No Color
+else
+    RED=''
+    GREEN=''
+    NC=''
+fi
+
+SLICE="$(dirname "$(readlink -f "${BASH_SOURCE[0]}")")/../layersvt/apidump-slice.py"
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+FAILURES=0
+
+# Append the text to the output file, frames are indexed at the offset they start
+append() {
+    printf '%s' "$2" >> "$1"
+}
+
+index_frame() {
+    echo "frame $2 $(wc -c < "$1")" >> "$1.idx"
+}
+
+index_end() {
+    echo "end $(wc -c < "$1")" >> "$1.idx"
+}
+
+# Write a json output of 3 frames, with the last frame cut short and no footer unless "complete" is given
+write_json() {
+    local FILE="$1"
+    rm -f "$FILE" "$FILE.idx"
+    echo "format json" > "$FILE.idx"
+
+    append "$FILE" $'[\n'
+    for FRAME in 0 1 2
+    do
+        [ $FRAME -gt 0 ] && append "$FILE" $',\n'
+        index_frame "$FILE" $FRAME
+        append "$FILE" $'{\n\t"frameNumber" : "'$FRAME$'",\n\t"apiCalls" :\n\t[\n'
+        append "$FILE" $'\t\t{\n\t\t\t"name" : "vkQueueSubmit",\n\t\t\t"returnType" : "VkResult"\n\t\t},\n'
+        append "$FILE" $'\t\t{\n\t\t\t"name" : "vkQueuePresentKHR",\n\t\t\t"returnType" : "VkResult"\n\t\t}'
+        if [ $FRAME -lt 2 ] || [ "$2" == "complete" ]
+        then
+            append "$FILE" $'\n\t]\n}'
+        fi
+    done
+    if [ "$2" == "complete" ]
+    then
+        index_end "$FILE"
+        append "$FILE" $'\n]\n'
+    fi
+}
+
+# Write a html output of 3 frames, with the last frame cut short and no footer unless "complete" is given
+write_html() {
+    local FILE="$1"
+    rm -f "$FILE" "$FILE.idx"
+    echo "format html" > "$FILE.idx"
+
+    append "$FILE" "<!doctype html><html><head></head><body><div id='wrapper'>"
+    for FRAME in 0 1 2
+    do
+        index_frame "$FILE" $FRAME
+        append "$FILE" "<details class='frm'><summary>Frame $FRAME</summary>"
+        append "$FILE" "<details class='fn'><summary>vkQueuePresentKHR</summary></details>"
+        if [ $FRAME -lt 2 ] || [ "$2" == "complete" ]
+        then
+            append "$FILE" "</details>"
+        fi
+    done
+    if [ "$2" == "complete" ]
+    then
+        index_end "$FILE"
+        append "$FILE" "</div></body></html>"
+    fi
+}
+
+# Check that the extracted json document parses and holds the expected frame numbers
+check_json() {
+    local FILE="$1"
+    shift
+    python3 -B "$SLICE" "$FILE" "$@" -o "$WORK_DIR/slice.json" || return 1
+    python3 -c 'import json, sys; frames = [frame["frameNumber"] for frame in json.load(open(sys.argv[1]))]; sys.exit(frames != sys.argv[2:])' \
+        "$WORK_DIR/slice.json" $(seq "$1" "${2:-$1}")
+}
+
+# Check that the extracted html document closes all its details and ends with the footer
+check_html() {
+    local FILE="$1"
+    shift
+    python3 -B "$SLICE" "$FILE" "$@" -o "$WORK_DIR/slice.html" || return 1
+    local OPENED=$(grep -o "<details" "$WORK_DIR/slice.html" | wc -l)
+    local CLOSED=$(grep -o "</details>" "$WORK_DIR/slice.html" | wc -l)
+    [ $OPENED -eq $CLOSED ] && [ "$(tail -c 20 "$WORK_DIR/slice.html")" == "</div></body></html>" ]
+}
+
+run_check() {
+    local DESCRIPTION="$1"
+    shift
+    if "$@"
+    then
+        echo "$DESCRIPTION: ok"
+    else
+        echo "$DESCRIPTION: failed"
+        FAILURES=$((FAILURES + 1))
+    fi
+}
+
+printf "$GREEN[ RUN      ]$NC $0\n"
+
+write_json "$WORK_DIR/complete.json" complete
+run_check "json, complete, first frame" check_json "$WORK_DIR/complete.json" 0
+run_check "json, complete, last frame" check_json "$WORK_DIR/complete.json" 2
+run_check "json, complete, all frames" check_json "$WORK_DIR/complete.json" 0 2
+
+write_json "$WORK_DIR/truncated.json" truncated
+run_check "json, truncated, first frame" check_json "$WORK_DIR/truncated.json" 0
+run_check "json, truncated, last frame" check_json "$WORK_DIR/truncated.json" 2
+run_check "json, truncated, all frames" check_json "$WORK_DIR/truncated.json" 0 2
+
+write_html "$WORK_DIR/complete.html" complete
+run_check "html, complete, last frame" check_html "$WORK_DIR/complete.html" 2
+run_check "html, complete, all frames" check_html "$WORK_DIR/complete.html" 0 2
+
+write_html "$WORK_DIR/truncated.html" truncated
+run_check "html, truncated, first frame" check_html "$WORK_DIR/truncated.html" 0
+run_check "html, truncated, last frame" check_html "$WORK_DIR/truncated.html" 2
+run_check "html, truncated, all frames" check_html "$WORK_DIR/truncated.html" 0 2
+
+if [ $FAILURES -ne 0 ]
+then
+    printf "$RED[  FAILED  ]$NC $0\n"
+    exit 1
+fi
+
+printf "$GREEN[  PASSED  ]$NC $0\n"
+
+exit 0
@@ -0,0 +1,97 @@
+#!/bin/bash
+
+# startup_benchmark.sh
+# This script will run vulkaninfo against the mock ICD several times, without layers and
+# with the monitor and screenshot layers enabled, and report the average run time of each.
+# The difference is the cost the layers add to vkCreateInstance and vkCreateDevice. The
+# script doesn't fail on timings, only when vulkaninfo fails. This script requires a path
+# to the Vulkan-Tools build directory so that it can locate vulkaninfo and the mock ICD.
+# The path can be defined using the environment variable VULKAN_TOOLS_BUILD_DIR or using
+# the command-line argument -t or --tools. The number of runs can be set using -n or --runs.
+
+# Track unrecognized arguments.
+UNRECOGNIZED=()
+
+RUNS=20
+
+# Parse the command-line arguments.
+while [[ $# -gt 0 ]]
+do
+   KEY="$1"
+   case $KEY in
+      -t|--tools)
+      VULKAN_TOOLS_BUILD_DIR="$2"
+      shift
+      shift
+      ;;
+      -n|--runs)
+      RUNS="$2"
+      shift
+      shift
+      ;;
+      *)
+      UNRECOGNIZED+=("$1")
+      shift
+      ;;
+   esac
+done
+
+# Reject unrecognized arguments.
+if [[ ${#UNRECOGNIZED[@]} -ne 0 ]]; then
+   echo "ERROR: $0:$LINENO"
+   echo "Unrecognized command-line arguments: ${UNRECOGNIZED[*]}"
+   exit 1
+fi
+
+if [ -z ${VULKAN_TOOLS_BUILD_DIR+x} ]; then
+   echo "ERROR: $0:$LINENO"
+   echo "Vulkan-Tools build directory is undefined."
+   echo "Please set VULKAN_TOOLS_BUILD_DIR or use the -t|--tools <path> command line option."
+   exit 1
+fi
+
+if [ -t 1 ] ; then
+    RED='\033[0;31m'
+    GREEN='\033[0;32m'
+    NC='\033[0m' # No Color
+else
+    RED=''
+    GREEN=''
+    NC=''
+fi
+
+VULKANINFO="$VULKAN_TOOLS_BUILD_DIR/install/bin/vulkaninfo"
+ICD="$VULKAN_TOOLS_BUILD_DIR/icd/VkICD_mock_icd.json"
+
+# Print the average run time in milliseconds of vulkaninfo with the layers given as argument
+run_vulkaninfo() {
+    local start=$(date +%s%N)
+    for (( i = 0; i < $RUNS; i++ ))
+    do
+        VK_ICD_FILENAMES="$ICD" VK_INSTANCE_LAYERS="$1" "$VULKANINFO" --summary > /dev/null 2>&1 || return 1
+    done
+    local end=$(date +%s%N)
+    echo $(( (end - start) / RUNS / 1000000 ))
+}
+
+printf "$GREEN[ RUN      ]$NC $0\n"
+
+BASELINE_MS=$(run_vulkaninfo "")
+if [ $? -ne 0 ]; then
+    printf "$RED[  FAILED  ]$NC $0: vulkaninfo failed without layers\n"
+    exit 1
+fi
+
+LAYERS_MS=$(run_vulkaninfo "VK_LAYER_LUNARG_monitor:VK_LAYER_LUNARG_screenshot")
+if [ $? -ne 0 ]; then
+    printf "$RED[  FAILED  ]$NC $0: vulkaninfo failed with the monitor and screenshot layers\n"
+    exit 1
+fi
+
+echo "No layers: $BASELINE_MS ms per run ($RUNS runs)"
+echo "VK_LAYER_LUNARG_monitor:VK_LAYER_LUNARG_screenshot: $LAYERS_MS ms per run ($RUNS runs)"
+echo "Layers overhead: $(( LAYERS_MS - BASELINE_MS )) ms per run"
+
+printf "$GREEN[  PASSED  ]$NC $0\n"
+
+exit 0
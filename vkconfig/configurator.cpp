@@ -50,7 +50,7 @@ Configurator::Configurator(const std::string &VULKAN_SDK)
     : path(VULKAN_SDK), environment(path), layers(environment), configurations(environment), request_vulkan_status(true) {}
 
 Configurator::~Configurator() {
-    configurations.SaveAllConfigurations(layers.available_layers);
+    configurations.SaveAllConfigurations(layers.GetLayers());
 
     if (!environment.UsePersistentOverrideMode()) {
         SurrenderConfiguration(environment);
@@ -67,16 +67,16 @@ bool Configurator::Init() {
         settings.setValue("crashed", false);
 
         if (Alert::ConfiguratorCrashed() == QMessageBox::No) {
-            configurations.LoadAllConfigurations(layers.available_layers);
+            configurations.LoadAllConfigurations(layers.GetLayers());
         }
     } else {
-        configurations.LoadAllConfigurations(layers.available_layers);
+        configurations.LoadAllConfigurations(layers.GetLayers());
     }
 
     if (configurations.Empty()) {
-        configurations.ResetDefaultsConfigurations(layers.available_layers);
+        configurations.ResetDefaultsConfigurations(layers.GetLayers());
     } else {
-        configurations.FirstDefaultsConfigurations(layers.available_layers);
+        configurations.FirstDefaultsConfigurations(layers.GetLayers());
     }
 
     const std::string configuration_name = this->environment.Get(ACTIVE_CONFIGURATION);
@@ -86,6 +86,13 @@ bool Configurator::Init() {
     return true;
 }
 
+void Configurator::UpdateUserDefinedLayersPaths(const std::vector<std::string> &paths) {
+    this->environment.SetPerConfigUserDefinedLayersPaths(paths);
+
+    const std::vector<std::string> &updated_layers = this->layers.UpdateUserDefinedLayers();
+    this->configurations.RefreshLayers(this->layers.GetLayers(), updated_layers);
+}
+
 void Configurator::ActivateConfiguration(const std::string &configuration_name) {
     const std::string name = configuration_name;
 
@@ -99,14 +106,12 @@ void Configurator::ActivateConfiguration(const std::string &configuration_name)
     // If the layers paths are differents, we need to reload the layers and the configurations
     const std::vector<std::string> paths = this->environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_GUI);
     if (configuration->user_defined_paths != paths) {
-        this->environment.SetPerConfigUserDefinedLayersPaths(configuration->user_defined_paths);
-        this->layers.LoadAllInstalledLayers();
-        this->configurations.LoadAllConfigurations(this->layers.available_layers);
+        this->UpdateUserDefinedLayersPaths(configuration->user_defined_paths);
     }
-    this->configurations.RefreshConfiguration(this->layers.available_layers);
+    this->configurations.RefreshConfiguration(this->layers.GetLayers());
 
     std::string missing_layer;
-    if (HasMissingLayer(configuration->parameters, layers.available_layers, missing_layer)) {
+    if (HasMissingLayer(configuration->parameters, layers.GetLayers(), missing_layer)) {
         QMessageBox alert;
         alert.QDialog::setWindowTitle("Vulkan layer missing...");
         alert.setText(format("%s couldn't find '%s' layer required by '%s' configuration:", VKCONFIG_NAME, missing_layer.c_str(),
@@ -159,10 +164,10 @@ void Configurator::ResetToDefault(bool hard) {
         this->environment.Set(ACTIVE_CONFIGURATION, "");  // Force ActivateConfiguration
         this->ActivateConfiguration(configuration_name);
 
-        this->configurations.ResetDefaultsConfigurations(this->layers.available_layers);
+        this->configurations.ResetDefaultsConfigurations(this->layers.GetLayers());
     } else {
-        this->configurations.ReloadDefaultsConfigurations(this->layers.available_layers);
+        this->configurations.ReloadDefaultsConfigurations(this->layers.GetLayers());
     }
 
-    this->configurations.RefreshConfiguration(this->layers.available_layers);
+    this->configurations.RefreshConfiguration(this->layers.GetLayers());
 }
@@ -48,6 +48,9 @@ class Configurator {
 
     void ActivateConfiguration(const std::string& configuration_name);
 
+    // Only load and unload the layers of the added and removed paths and update the configurations using them
+    void UpdateUserDefinedLayersPaths(const std::vector<std::string>& paths);
+
     void ResetToDefault(bool hard);
 
     std::string profile_file;
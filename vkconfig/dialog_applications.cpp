@@ -133,7 +133,7 @@ void ApplicationsDialog::on_pushButtonAdd_clicked()  // Pick the test applicatio
 
         QTreeWidgetItem *item = CreateApplicationItem(new_application);
 
-        configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+        configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
         ui->treeWidget->setCurrentItem(item);
         configurator.environment.SelectActiveApplication(ui->treeWidget->indexOfTopLevelItem(item));
     }
@@ -178,7 +178,7 @@ void ApplicationsDialog::on_pushButtonRemove_clicked() {
     ui->lineEditWorkingFolder->setText("");
     ui->lineEditLogFile->setText("");
 
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
     ui->treeWidget->update();
 }
 
@@ -120,7 +120,7 @@ LayersDialog::LayersDialog(QWidget *parent, const Configuration &configuration)
     setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint);
 
     Configurator &configurator = Configurator::Get();
-    configurator.configurations.SaveAllConfigurations(configurator.layers.available_layers);
+    configurator.configurations.SaveAllConfigurations(configurator.layers.GetLayers());
 
     ui->lineEditName->setText(configuration.key.c_str());
     ui->lineEditDescription->setText(configuration.description.c_str());
@@ -199,11 +199,7 @@ void LayersDialog::Reload() {
     std::vector<std::string> user_defined_paths = this->configuration.user_defined_paths;
 
     Configurator &configurator = Configurator::Get();
-    configurator.configurations.available_configurations.clear();
-    configurator.environment.SetPerConfigUserDefinedLayersPaths(this->configuration.user_defined_paths);
-
-    configurator.layers.LoadAllInstalledLayers();
-    configurator.configurations.LoadAllConfigurations(configurator.layers.available_layers);
+    configurator.UpdateUserDefinedLayersPaths(this->configuration.user_defined_paths);
 
     Configuration *saved_configuration =
         FindByKey(configurator.configurations.available_configurations, configuration_name.c_str());
@@ -215,7 +211,7 @@ void LayersDialog::Reload() {
     RestoreParameterStates(this->configuration.parameters, ParameterStates);
     this->configuration.user_defined_paths = user_defined_paths;
 
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
     configurator.request_vulkan_status = true;
 }
 
@@ -270,9 +266,7 @@ void LayersDialog::OnLayerTreeSortedClicked(QTreeWidgetItem *item, int column) {
 void LayersDialog::AddLayerItem(const Parameter &parameter) {
     assert(!parameter.key.empty());
 
-    std::vector<Layer> &available_layers = Configurator::Get().layers.available_layers;
-
-    const Layer *layer = FindByKey(available_layers, parameter.key.c_str());
+    const Layer *layer = Configurator::Get().layers.FindLayer(parameter.key);
 
     std::string decorated_name(parameter.key);
 
@@ -373,8 +367,8 @@ void LayersDialog::LoadUserDefinedPaths() {
         item->setExpanded(true);
 
         // Look for layers that are loaded that are also from this folder
-        for (std::size_t i = 0, n = configurator.layers.available_layers.size(); i < n; ++i) {
-            const Layer &layer = configurator.layers.available_layers[i];
+        for (std::size_t i = 0, n = configurator.layers.GetLayers().size(); i < n; ++i) {
+            const Layer &layer = configurator.layers.GetLayers()[i];
 
             const QFileInfo file_info(layer.manifest_path.c_str());
             const std::string path(ConvertNativeSeparators(file_info.path().toStdString()));
@@ -413,23 +407,20 @@ void LayersDialog::resizeEvent(QResizeEvent *event) {
 }
 
 void LayersDialog::on_button_properties_clicked() {
-    const std::vector<Layer> &available_layers = Configurator::Get().layers.available_layers;
-    const Layer *layer = FindByKey(available_layers, this->selected_available_layer_name.c_str());
+    const Layer *layer = Configurator::Get().layers.FindLayer(this->selected_available_layer_name);
 
     Alert::LayerProperties(layer);
 }
 
 void LayersDialog::on_button_doc_clicked() {
-    const std::vector<Layer> &available_layers = Configurator::Get().layers.available_layers;
-    const Layer *layer = FindByKey(available_layers, this->selected_available_layer_name.c_str());
+    const Layer *layer = Configurator::Get().layers.FindLayer(this->selected_available_layer_name);
     const std::string path = format("%s/%s.html", GetPath(BUILTIN_PATH_APPDATA).c_str(), layer->key.c_str());
     ExportHtmlDoc(*layer, path);
     QDesktopServices::openUrl(QUrl(("file:///" + path).c_str()));
 }
 
 void LayersDialog::on_button_website_clicked() {
-    const std::vector<Layer> &available_layers = Configurator::Get().layers.available_layers;
-    const Layer *layer = FindByKey(available_layers, this->selected_available_layer_name.c_str());
+    const Layer *layer = Configurator::Get().layers.FindLayer(this->selected_available_layer_name);
     QDesktopServices::openUrl(QUrl(layer->url.c_str()));
 }
 
@@ -459,7 +450,7 @@ void LayersDialog::on_button_reset_clicked() {
     selected_available_layer_name.clear();
     selected_sorted_layer_name.clear();
 
-    configuration.Reset(configurator.layers.available_layers, configurator.path);
+    configuration.Reset(configurator.layers.GetLayers(), configurator.path);
 
     this->Reinit();
 
@@ -480,7 +471,7 @@ void LayersDialog::OverrideOrder(const std::string layer_name, const TreeWidgetI
 
     std::swap(below_parameter->overridden_rank, above_parameter->overridden_rank);
 
-    OrderParameter(configuration.parameters, Configurator::Get().layers.available_layers);
+    OrderParameter(configuration.parameters, Configurator::Get().layers.GetLayers());
     LoadAvailableLayersUI();
     LoadSortedLayersUI();
     LoadUserDefinedPaths();
@@ -536,8 +527,7 @@ void LayersDialog::UpdateButtons() {
     bool enabled_url = false;
 
     if (enabled) {
-        std::vector<Layer> &available_layers = Configurator::Get().layers.available_layers;
-        const Layer *layer = FindByKey(available_layers, selected_available_layer_name.c_str());
+        const Layer *layer = Configurator::Get().layers.FindLayer(selected_available_layer_name);
         assert(layer != nullptr);
         if (!layer->url.empty()) enabled_url = true;
     }
@@ -552,9 +542,7 @@ void LayersDialog::OverrideAllExplicitLayers() {
         if (it->state != LAYER_STATE_APPLICATION_CONTROLLED) continue;
 
         Configurator &configurator = Configurator::Get();
-        std::vector<Layer> &available_layers = configurator.layers.available_layers;
-
-        const Layer *layer = FindByKey(available_layers, it->key.c_str());
+        const Layer *layer = configurator.layers.FindLayer(it->key);
         if (layer == nullptr) continue;
 
         if (layer->type == LAYER_TYPE_IMPLICIT) continue;
@@ -585,8 +573,7 @@ void LayersDialog::layerUseChanged(QTreeWidgetItem *item, int selection) {
             OverrideAllExplicitLayers();
         }
     } else if (layer_state == LAYER_STATE_EXCLUDED) {
-        const std::vector<Layer> &available_layers = Configurator::Get().layers.available_layers;
-        const Layer *layer = FindByKey(available_layers, tree_layer_item->layer_name.c_str());
+        const Layer *layer = Configurator::Get().layers.FindLayer(tree_layer_item->layer_name);
 
         if (layer != nullptr) {
             if (layer->type == LAYER_TYPE_IMPLICIT) {
@@ -600,7 +587,7 @@ void LayersDialog::layerUseChanged(QTreeWidgetItem *item, int selection) {
     current_parameter->state = layer_state;
     current_parameter->overridden_rank = Parameter::NO_RANK;
 
-    OrderParameter(this->configuration.parameters, Configurator::Get().layers.available_layers);
+    OrderParameter(this->configuration.parameters, Configurator::Get().layers.GetLayers());
 
     ui->button_reset->setEnabled(true);
 
@@ -671,7 +658,7 @@ void LayersDialog::accept() {
     Version loader_version;
     if (!configurator.SupportDifferentLayerVersions(&loader_version)) {
         std::string log_versions;
-        if (!configurator.configurations.CheckLayersVersions(configurator.layers.available_layers, &this->configuration,
+        if (!configurator.configurations.CheckLayersVersions(configurator.layers.GetLayers(), &this->configuration,
                                                              log_versions)) {
             Alert::LayerIncompatibleVersions(log_versions.c_str(), loader_version);
             return;
@@ -694,10 +681,10 @@ void LayersDialog::accept() {
     saved_configuration->user_defined_paths = this->configuration.user_defined_paths;
     saved_configuration->setting_tree_state.clear();
 
-    configurator.configurations.SaveAllConfigurations(configurator.layers.available_layers);
-    configurator.configurations.LoadAllConfigurations(configurator.layers.available_layers);
+    configurator.configurations.SaveAllConfigurations(configurator.layers.GetLayers());
+    configurator.configurations.LoadAllConfigurations(configurator.layers.GetLayers());
 
-    configurator.configurations.SetActiveConfiguration(configurator.layers.available_layers, active_configuration_name.c_str());
+    configurator.configurations.SetActiveConfiguration(configurator.layers.GetLayers(), active_configuration_name.c_str());
     QDialog::accept();
 }
 
@@ -718,5 +705,5 @@ void LayersDialog::reject() {
 
 void LayersDialog::BuildParameters() {
     Configurator &configurator = Configurator::Get();
-    this->configuration.parameters = GatherParameters(this->configuration.parameters, configurator.layers.available_layers);
+    this->configuration.parameters = GatherParameters(this->configuration.parameters, configurator.layers.GetLayers());
 }
@@ -23,15 +23,13 @@
 
 #include "../vkconfig_core/platform.h"
 
-#include <stdlib.h>
-#include <QProcess>
-#include <QDir>
-#include <QByteArray>
-#include <QTextStream>
 #include <QMessageBox>
 #include <QJsonDocument>
 
-VulkanAnalysisDialog::VulkanAnalysisDialog(QWidget *parent) : QDialog(parent), ui(new Ui::dialog_vulkan_analysis) {
+#include <cassert>
+
+VulkanAnalysisDialog::VulkanAnalysisDialog(QWidget *parent, const VulkanProbe &probe)
+    : QDialog(parent), ui(new Ui::dialog_vulkan_analysis) {
     ui->setupUi(this);
     setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint);
 
@@ -39,10 +37,13 @@ VulkanAnalysisDialog::VulkanAnalysisDialog(QWidget *parent) : QDialog(parent), u
     // This may be added back again later.
     ui->tabWidget->removeTab(2);
 
-    Run();
+    Run(probe);
 }
 
-void VulkanAnalysisDialog::Run() {
+void VulkanAnalysisDialog::Run(const VulkanProbe &probe) {
+    assert(probe.GetTask() == VULKAN_PROBE_ANALYSIS);
+    assert(probe.isFinished());
+
     ui->envTable->clear();
     ui->cleanupTable->clear();
     ui->hardwareTable->clear();
@@ -57,51 +58,29 @@ void VulkanAnalysisDialog::Run() {
     ui->logicalDevicesTable->clear();
     ui->physicalDevicesTable->clear();
 
-    QProcess *via = new QProcess(this);
-#if VKC_PLATFORM == VKC_PLATFORM_MACOS
-    via->setProgram("/usr/local/bin/vkvia");
-#else
-    via->setProgram("vkvia");
-#endif
-
-    const QString &file_Path = QDir::temp().path() + "/vkvia.json";
-
-    // Remove the old one
-    remove(file_Path.toUtf8().constData());
-
-    QStringList args;
-    args << "--output_path" << QDir::temp().path();
-    args << "--vkconfig_output";
-    args << "--disable_cube_tests";
-    via->setArguments(args);
-    via->start();
-    via->waitForFinished();
-
-    QFile file(file_Path);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QMessageBox msgBox;
-        msgBox.setText(tr("Error running vkvia. Is your SDK up to date and installed properly?"));
-        msgBox.exec();
-        return;
-    }
-
-    QString json_text = file.readAll();
-    file.close();
-
-    //////////////////////////////////////////////////////
-    // Convert the text to a JSON document & validate it
-    QJsonParseError parse_error;
-    QJsonDocument json_document = QJsonDocument::fromJson(json_text.toUtf8(), &parse_error);
-
-    if (parse_error.error != QJsonParseError::NoError) {
-        QMessageBox msgBox;
-        msgBox.setWindowTitle("Cannot parse vkvia output.");
-        msgBox.setText(parse_error.errorString());
-        msgBox.exec();
-        return;
+    switch (probe.GetResult()) {
+        case VULKAN_PROBE_SUCCESS: {
+            break;
+        }
+        case VULKAN_PROBE_PARSE_FAILURE: {
+            QMessageBox msgBox;
+            msgBox.setWindowTitle("Cannot parse vkvia output.");
+            msgBox.setText(probe.GetError());
+            msgBox.exec();
+            return;
+        }
+        case VULKAN_PROBE_CANCELED: {
+            return;
+        }
+        default: {
+            QMessageBox msgBox;
+            msgBox.setText(tr("Error running vkvia. Is your SDK up to date and installed properly?"));
+            msgBox.exec();
+            return;
+        }
     }
 
-    if (json_document.isEmpty() || json_document.isNull()) return;
+    const QJsonDocument &json_document = probe.GetDocument();
 
     /////////////////////////////////////////////////////////
     // Get the instance version and set that to the header
@@ -23,6 +23,8 @@
 
 #include "ui_dialog_vulkan_analysis.h"
 
+#include "vulkan_probe.h"
+
 #include <QJsonObject>
 
 #include <memory>
@@ -31,13 +33,13 @@ class VulkanAnalysisDialog : public QDialog {
     Q_OBJECT
 
    public:
-    explicit VulkanAnalysisDialog(QWidget* parent = nullptr);
+    VulkanAnalysisDialog(QWidget* parent, const VulkanProbe& probe);
 
    private:
     VulkanAnalysisDialog(const VulkanAnalysisDialog&) = delete;
     VulkanAnalysisDialog& operator=(const VulkanAnalysisDialog&) = delete;
 
-    void Run();
+    void Run(const VulkanProbe& probe);
     void LoadTable(QJsonObject& json_parent, QTableWidget* table);
 
     std::unique_ptr<Ui::dialog_vulkan_analysis> ui;
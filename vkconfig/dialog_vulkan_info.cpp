@@ -24,12 +24,7 @@
 #include "../vkconfig_core/util.h"
 #include "../vkconfig_core/platform.h"
 
-#include <QProcess>
-#include <QFile>
-#include <QTextStream>
-#include <QDir>
 #include <QJsonDocument>
-#include <QJsonParseError>
 #include <QJsonObject>
 #include <QJsonValue>
 #include <QJsonArray>
@@ -40,73 +35,42 @@
 #include <cstdlib>
 #include <cassert>
 
-VulkanInfoDialog::VulkanInfoDialog(QWidget *parent) : QDialog(parent), ui(new Ui::dialog_vulkan_info) {
+VulkanInfoDialog::VulkanInfoDialog(QWidget *parent, const VulkanProbe &probe) : QDialog(parent), ui(new Ui::dialog_vulkan_info) {
     ui->setupUi(this);
     setWindowFlags(windowFlags() & ~Qt::WindowContextHelpButtonHint);
 
-    Run();
+    Run(probe);
 }
 
-void VulkanInfoDialog::Run() {
-    static const char *VULKAN_INFO_PATH[] = {
-        "vulkaninfoSDK",              // PLATFORM_WINDOWS
-        "vulkaninfo",                 // PLATFORM_LINUX
-        "/usr/local/bin/vulkaninfo",  // PLATFORM_MACOS
-        "N/A",                        // PLATFORM_ANDROID
-    };
-    static_assert(countof(VULKAN_INFO_PATH) == PLATFORM_COUNT,
-                  "The tranlation table size doesn't match the enum number of elements");
+void VulkanInfoDialog::Run(const VulkanProbe &probe) {
+    assert(probe.GetTask() == VULKAN_PROBE_INFO);
+    assert(probe.isFinished());
 
     ui->treeWidget->clear();
 
-    QProcess *vulkan_info = new QProcess(this);
-    vulkan_info->setProgram(VULKAN_INFO_PATH[VKC_PLATFORM]);
-
-    QString filePath = QDir::temp().path();
-
-    QStringList args;
-    args << "--vkconfig_output";
-    args << filePath;
-
-    // Wait... make sure we don't pick up the old one!
-    filePath += "/vulkaninfo.json";
-    remove(filePath.toUtf8().constData());
-
-    // Lock and load...
-    vulkan_info->setArguments(args);
-    vulkan_info->start();
-    vulkan_info->waitForFinished();
-
-    // Check for the output file
-    QFile file(filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        QMessageBox msgBox;
-        msgBox.setText("Error running vulkaninfo. Is your SDK up to date and installed properly?");
-        msgBox.exec();
-        return;
-    }
-
-    QString jsonText = file.readAll();
-    file.close();
-
-    //////////////////////////////////////////////////////
-    // Convert the text to a JSON document & validate it
-    QJsonParseError parseError;
-    QJsonDocument jsonDoc = QJsonDocument::fromJson(jsonText.toUtf8(), &parseError);
-    if (parseError.error != QJsonParseError::NoError) {
-        QMessageBox msgBox;
-        msgBox.setWindowTitle("Cannot parse vulkaninfo output.");
-        msgBox.setText(parseError.errorString());
-        msgBox.exec();
-        return;
+    switch (probe.GetResult()) {
+        case VULKAN_PROBE_SUCCESS: {
+            break;
+        }
+        case VULKAN_PROBE_PARSE_FAILURE: {
+            QMessageBox msgBox;
+            msgBox.setWindowTitle("Cannot parse vulkaninfo output.");
+            msgBox.setText(probe.GetError());
+            msgBox.exec();
+            return;
+        }
+        case VULKAN_PROBE_CANCELED: {
+            return;
+        }
+        default: {
+            QMessageBox msgBox;
+            msgBox.setText("Error running vulkaninfo. Is your SDK up to date and installed properly?");
+            msgBox.exec();
+            return;
+        }
     }
 
-    if (jsonDoc.isNull() || jsonDoc.isEmpty()) {
-        QMessageBox msgBox;
-        msgBox.setText(tr("Json document is empty!"));
-        msgBox.exec();
-        return;
-    }
+    const QJsonDocument &jsonDoc = probe.GetDocument();
 
     /////////////////////////////////////////////////////////
     // Get the instance version and set that to the header
@@ -23,13 +23,15 @@
 
 #include "ui_dialog_vulkan_info.h"
 
+#include "vulkan_probe.h"
+
 #include <memory>
 
 class VulkanInfoDialog : public QDialog {
     Q_OBJECT
 
    public:
-    explicit VulkanInfoDialog(QWidget *parent = nullptr);
+    VulkanInfoDialog(QWidget *parent, const VulkanProbe &probe);
 
    private:
     VulkanInfoDialog(const VulkanInfoDialog &) = delete;
@@ -42,7 +44,7 @@ class VulkanInfoDialog : public QDialog {
     void BuildDevices(QJsonValue &json_value, QTreeWidgetItem *root);
     void TraverseGenericProperties(QJsonValue &parent_json, QTreeWidgetItem *parent_tree_item);
 
-    void Run();
+    void Run(const VulkanProbe &probe);
 
     std::unique_ptr<Ui::dialog_vulkan_info> ui;
 };
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "launch_capture.h"
+
+#include <QProcess>
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+
+static const std::size_t LAUNCH_CAPTURE_BUFFER_SIZE = 1 << 20;  // More than the log window displays
+static const int LAUNCH_CAPTURE_WAIT = 50;                       // In milliseconds, to check for termination requests
+static const int LAUNCH_START_TIMEOUT = 4000;                    // In milliseconds, more than enough time
+
+LaunchCapture::LaunchCapture(const QString &program, const QStringList &arguments, const QString &working_folder,
+                             const QStringList &environment, QFile *log_file, QObject *parent)
+    : QThread(parent),
+      program(program),
+      arguments(arguments),
+      working_folder(working_folder),
+      environment(environment),
+      log_file(log_file),
+      state(LAUNCH_STARTING),
+      ring(LAUNCH_CAPTURE_BUFFER_SIZE),
+      ring_begin(0),
+      ring_size(0),
+      line_count(0),
+      byte_count(0),
+      dropped_byte_count(0) {}
+
+LaunchCapture::~LaunchCapture() {
+    this->requestInterruption();
+    this->wait();
+}
+
+void LaunchCapture::run() {
+    QProcess process;
+    process.setProgram(this->program);
+    process.setWorkingDirectory(this->working_folder);
+    process.setEnvironment(this->environment);
+    process.setArguments(this->arguments);
+    process.setProcessChannelMode(QProcess::MergedChannels);
+
+    process.start(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    process.closeWriteChannel();
+
+    if (!process.waitForStarted(LAUNCH_START_TIMEOUT)) {
+        this->state = LAUNCH_FAILED;
+        return;
+    }
+
+    this->state = LAUNCH_RUNNING;
+
+    while (process.state() != QProcess::NotRunning) {
+        if (this->isInterruptionRequested()) {
+            process.kill();
+            process.waitForFinished();
+            break;
+        }
+
+        process.waitForReadyRead(LAUNCH_CAPTURE_WAIT);
+        this->Capture(process.readAll());
+    }
+
+    // Output written right before the application exited
+    this->Capture(process.readAll());
+
+    this->state = LAUNCH_TERMINATED;
+}
+
+void LaunchCapture::Capture(const QByteArray &data) {
+    if (data.isEmpty()) return;
+
+    if (this->log_file != nullptr && this->log_file->isOpen()) {
+        this->log_file->write(data);
+    }
+
+    const std::size_t capacity = this->ring.size();
+
+    const char *source = data.constData();
+    std::size_t size = static_cast<std::size_t>(data.size());
+
+    QMutexLocker locker(&this->mutex);
+
+    this->byte_count += size;
+    this->line_count += static_cast<std::size_t>(std::count(source, source + size, '\n'));
+
+    // Drop the oldest output that the user interface didn't take yet
+    if (size >= capacity) {
+        this->dropped_byte_count += this->ring_size + size - capacity;
+        source += size - capacity;
+        size = capacity;
+        this->ring_begin = 0;
+        this->ring_size = 0;
+    } else if (this->ring_size + size > capacity) {
+        const std::size_t overflow = this->ring_size + size - capacity;
+        this->dropped_byte_count += overflow;
+        this->ring_begin = (this->ring_begin + overflow) % capacity;
+        this->ring_size -= overflow;
+    }
+
+    const std::size_t end = (this->ring_begin + this->ring_size) % capacity;
+    const std::size_t first_size = std::min(size, capacity - end);
+    std::memcpy(&this->ring[end], source, first_size);
+    std::memcpy(&this->ring[0], source + first_size, size - first_size);
+    this->ring_size += size;
+}
+
+bool LaunchCapture::TakeOutput(std::string &output) {
+    output.clear();
+
+    QMutexLocker locker(&this->mutex);
+
+    if (this->ring_size == 0) return false;
+
+    const std::size_t capacity = this->ring.size();
+    const std::size_t first_size = std::min(this->ring_size, capacity - this->ring_begin);
+
+    output.reserve(this->ring_size);
+    output.append(&this->ring[this->ring_begin], first_size);
+    output.append(&this->ring[0], this->ring_size - first_size);
+
+    this->ring_begin = 0;
+    this->ring_size = 0;
+
+    return true;
+}
+
+std::size_t LaunchCapture::GetLineCount() const {
+    QMutexLocker locker(&this->mutex);
+    return this->line_count;
+}
+
+std::size_t LaunchCapture::GetByteCount() const {
+    QMutexLocker locker(&this->mutex);
+    return this->byte_count;
+}
+
+std::size_t LaunchCapture::GetDroppedByteCount() const {
+    QMutexLocker locker(&this->mutex);
+    return this->dropped_byte_count;
+}
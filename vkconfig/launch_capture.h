@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#pragma once
+
+#include <QThread>
+#include <QMutex>
+#include <QFile>
+#include <QString>
+#include <QStringList>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+enum LaunchState { LAUNCH_STARTING = 0, LAUNCH_RUNNING, LAUNCH_FAILED, LAUNCH_TERMINATED };
+
+// Run a Vulkan application and capture its output on a worker thread. The output is kept in a ring buffer that the user
+// interface drains at its own rate, so a verbose application is neither slowed down by a full pipe nor freezing the
+// user interface. When the user interface falls behind, the oldest output is dropped from the ring buffer but is still
+// written in the log file.
+class LaunchCapture : public QThread {
+    Q_OBJECT
+
+   public:
+    LaunchCapture(const QString& program, const QStringList& arguments, const QString& working_folder,
+                  const QStringList& environment, QFile* log_file, QObject* parent = nullptr);
+    ~LaunchCapture();
+
+    const QString& GetProgram() const { return this->program; }
+    LaunchState GetState() const { return this->state; }
+
+    // Move the output captured since the previous call, return false when there is no new output
+    bool TakeOutput(std::string& output);
+
+    std::size_t GetLineCount() const;
+    std::size_t GetByteCount() const;
+    std::size_t GetDroppedByteCount() const;
+
+   protected:
+    void run() override;
+
+   private:
+    LaunchCapture(const LaunchCapture&) = delete;
+    LaunchCapture& operator=(const LaunchCapture&) = delete;
+
+    void Capture(const QByteArray& data);
+
+    const QString program;
+    const QStringList arguments;
+    const QString working_folder;
+    const QStringList environment;
+    QFile* log_file;  // Only written by the capture thread while it's running
+
+    std::atomic<LaunchState> state;
+
+    mutable QMutex mutex;
+    std::vector<char> ring;
+    std::size_t ring_begin;
+    std::size_t ring_size;
+    std::size_t line_count;
+    std::size_t byte_count;
+    std::size_t dropped_byte_count;
+};
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "layers_batch.h"
+
+#include "../vkconfig_core/override.h"
+#include "../vkconfig_core/util.h"
+
+#include <QString>
+#include <QRegularExpression>
+
+#include <cassert>
+
+LayersBatch::LayersBatch(Environment& environment)
+    : environment(environment),
+      layers(environment),
+      configurations(environment),
+      has_configuration(false),
+      has_configurations(false),
+      has_override(false) {
+    this->layers.LoadAllInstalledLayers();
+}
+
+BatchResult LayersBatch::Run(const std::string& line) {
+    const QString trimmed_line = QString(line.c_str()).trimmed();
+    if (trimmed_line.isEmpty() || trimmed_line.startsWith("#")) return BATCH_IGNORED;
+
+    const int separator = trimmed_line.indexOf(QRegularExpression("\\s"));
+    const std::string command = (separator < 0 ? trimmed_line : trimmed_line.left(separator)).toStdString();
+    const std::string argument = (separator < 0 ? QString() : trimmed_line.mid(separator).trimmed()).toStdString();
+
+    if (command == "configuration") {
+        if (argument.empty()) return BATCH_INVALID;
+        return LoadConfiguration(argument) ? BATCH_SUCCESS : BATCH_FAILURE;
+    } else if (command == "override") {
+        if (!argument.empty()) {
+            if (!LoadConfiguration(argument)) return BATCH_FAILURE;
+        }
+        if (!this->has_configuration) return BATCH_INVALID;
+        return Override() ? BATCH_SUCCESS : BATCH_FAILURE;
+    } else if (command == "apply") {
+        if (argument.empty()) return BATCH_INVALID;
+        return ApplyConfiguration(argument) ? BATCH_SUCCESS : BATCH_FAILURE;
+    } else if (command == "surrender") {
+        if (!argument.empty()) return BATCH_INVALID;
+        return Surrender() ? BATCH_SUCCESS : BATCH_FAILURE;
+    } else if (command == "reload") {
+        if (!argument.empty()) return BATCH_INVALID;
+        return Reload() ? BATCH_SUCCESS : BATCH_FAILURE;
+    }
+
+    return BATCH_INVALID;
+}
+
+bool LayersBatch::Reload() {
+    // All the previous and the reloaded layers may have changed
+    std::vector<std::string> layer_keys;
+    for (std::size_t i = 0, n = this->layers.GetLayers().size(); i < n; ++i) {
+        layer_keys.push_back(this->layers.GetLayers()[i].key);
+    }
+
+    this->layers.LoadAllInstalledLayers();
+
+    for (std::size_t i = 0, n = this->layers.GetLayers().size(); i < n; ++i) {
+        AppendString(layer_keys, this->layers.GetLayers()[i].key);
+    }
+
+    // The settings of the configurations are instantiated again from the reloaded layers and the override layers are kept in
+    // sync with the installed layers
+    return this->Refresh(layer_keys);
+}
+
+bool LayersBatch::Refresh(const std::vector<std::string>& layer_keys) {
+    if (layer_keys.empty()) return true;
+
+    if (this->has_configurations) {
+        this->configurations.RefreshLayers(this->layers.GetLayers(), layer_keys);
+    }
+
+    if (this->has_configuration) {
+        this->configuration.RefreshLayers(this->layers.GetLayers(), layer_keys);
+    }
+
+    if (!this->has_override) return true;
+
+    return Override();
+}
+
+bool LayersBatch::LoadConfiguration(const std::string& path) {
+    this->configuration = Configuration();
+    this->has_configuration = this->configuration.Load(this->layers.GetLayers(), path);
+    return this->has_configuration;
+}
+
+bool LayersBatch::ApplyConfiguration(const std::string& name) {
+    if (!this->has_configurations) {
+        // The environment of the command line is reset to the defaults, LoadAllConfigurations would take it for a first run and
+        // replace the configuration files of the user by the built-in configurations
+        this->configurations.LoadAllConfigurationsReadOnly(this->layers.GetLayers());
+        this->has_configurations = true;
+    }
+
+    const Configuration* found_configuration = FindByKey(this->configurations.available_configurations, name.c_str());
+    if (found_configuration == nullptr) return false;
+
+    this->configuration = *found_configuration;
+    this->has_configuration = true;
+
+    return Override();
+}
+
+bool LayersBatch::Override() {
+    assert(this->has_configuration);
+
+    // With command line, don't store the application list, it's always global, save and restore the setting
+    const bool use_application_list = this->environment.UseApplicationListOverrideMode();
+    this->environment.SetMode(OVERRIDE_MODE_LIST, false);
+
+    const bool result = OverrideConfiguration(this->environment, this->layers.GetLayers(), this->configuration);
+
+    this->environment.SetMode(OVERRIDE_MODE_LIST, use_application_list);
+
+    this->has_override = result;
+    return result;
+}
+
+bool LayersBatch::Surrender() {
+    this->has_override = false;
+    return SurrenderConfiguration(this->environment);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#pragma once
+
+#include "../vkconfig_core/configuration.h"
+#include "../vkconfig_core/configuration_manager.h"
+#include "../vkconfig_core/layer_manager.h"
+#include "../vkconfig_core/environment.h"
+
+#include <string>
+
+enum BatchResult { BATCH_SUCCESS = 0, BATCH_FAILURE, BATCH_INVALID, BATCH_IGNORED };
+
+// Run layers commands, one per line, while keeping the installed layers loaded between commands:
+// - configuration <layers_configuration_file>
+// - override [<layers_configuration_file>]
+// - apply <layers_configuration_name>
+// - surrender
+// - reload
+// Empty lines and lines starting with '#' are ignored.
+class LayersBatch {
+   public:
+    LayersBatch(Environment& environment);
+
+    BatchResult Run(const std::string& line);
+
+    // Rescan the installed layers and override again with the last overridden configuration
+    bool Reload();
+
+    // Instantiate again the settings of the layers updated by LayerWatcher and override again with the last overridden
+    // configuration. The previous layers need to be alive until this is done.
+    bool Refresh(const std::vector<std::string>& layer_keys);
+
+    const std::vector<Layer>& GetLayers() const { return layers.GetLayers(); }
+    LayerManager& GetLayerManager() { return layers; }
+
+   private:
+    LayersBatch(const LayersBatch&) = delete;
+    LayersBatch& operator=(const LayersBatch&) = delete;
+
+    bool LoadConfiguration(const std::string& path);
+    bool ApplyConfiguration(const std::string& name);
+    bool Override();
+    bool Surrender();
+
+    Environment& environment;
+    LayerManager layers;
+    ConfigurationManager configurations;
+    Configuration configuration;
+    bool has_configuration;
+    bool has_configurations;  // 'configurations' is loaded on the first 'apply' command
+    bool has_override;
+};
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "layers_daemon.h"
+
+#include "../vkconfig_core/util.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+
+#include <cassert>
+#include <cstdio>
+
+LayersDaemon::LayersDaemon(Environment& environment)
+    : environment(environment), batch(environment), watcher(batch.GetLayerManager()) {
+    this->connect(&this->server, SIGNAL(newConnection()), this, SLOT(OnNewConnection()));
+    this->connect(&this->watcher, SIGNAL(LayersChanged()), this, SLOT(OnLayersChanged()));
+}
+
+bool LayersDaemon::Listen(const std::string& server_name) {
+    // A previous daemon that crashed may have left its socket file behind on UNIX
+    QLocalServer::removeServer(server_name.c_str());
+
+    this->server.setSocketOptions(QLocalServer::UserAccessOption);
+    if (!this->server.listen(server_name.c_str())) return false;
+
+    printf("Listening on \"%s\" with %d Vulkan layers loaded\n", this->server.fullServerName().toStdString().c_str(),
+           static_cast<int>(this->batch.GetLayers().size()));
+    fflush(stdout);
+    return true;
+}
+
+void LayersDaemon::OnNewConnection() {
+    while (this->server.hasPendingConnections()) {
+        QLocalSocket* socket = this->server.nextPendingConnection();
+
+        this->connect(socket, SIGNAL(readyRead()), this, SLOT(OnReadyRead()));
+        this->connect(socket, SIGNAL(disconnected()), socket, SLOT(deleteLater()));
+    }
+}
+
+void LayersDaemon::OnReadyRead() {
+    QLocalSocket* socket = qobject_cast<QLocalSocket*>(this->sender());
+    assert(socket != nullptr);
+
+    while (socket->canReadLine()) {
+        const QString line = QString::fromUtf8(socket->readLine()).trimmed();
+
+        if (line == "quit") {
+            socket->write("done\n");
+            socket->flush();
+            QCoreApplication::quit();
+            return;
+        }
+
+        // Pending layers directories changes are applied before the command so it always sees the installed layers
+        if (this->watcher.HasPendingChanges()) {
+            this->OnLayersChanged();
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        const BatchResult result = this->batch.Run(line.toStdString());
+        const double elapsed = timer.nsecsElapsed() / 1000000.0;
+
+        // The reloaded layers may come from other search paths, watch them instead of the previous ones
+        if (line == "reload" && result == BATCH_SUCCESS) {
+            this->watcher.Reset();
+        }
+
+        switch (result) {
+            case BATCH_SUCCESS:
+                socket->write(format("done (%.3f ms)\n", elapsed).c_str());
+                break;
+            case BATCH_FAILURE:
+                socket->write(format("failed (%.3f ms)\n", elapsed).c_str());
+                break;
+            case BATCH_INVALID:
+                socket->write("invalid command\n");
+                break;
+            case BATCH_IGNORED:
+                socket->write("ignored\n");
+                break;
+        }
+        socket->flush();
+    }
+}
+
+void LayersDaemon::OnLayersChanged() {
+    QElapsedTimer timer;
+    timer.start();
+
+    const std::vector<std::string>& layer_keys = this->watcher.Apply();
+    const bool result = this->batch.Refresh(layer_keys);
+
+    const std::vector<LayerManifestError>& errors = this->watcher.GetErrors();
+    for (std::size_t i = 0, n = errors.size(); i < n; ++i) {
+        printf("Invalid layer manifest \"%s\", the layer is ignored: %s\n", errors[i].manifest_path.c_str(),
+               errors[i].message.c_str());
+    }
+
+    printf("Layers directories changed, %d Vulkan layers updated%s (%.3f ms)\n", static_cast<int>(layer_keys.size()),
+           result ? "" : ", failed to override", timer.nsecsElapsed() / 1000000.0);
+    fflush(stdout);
+}
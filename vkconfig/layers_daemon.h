@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#pragma once
+
+#include "layers_batch.h"
+
+#include "../vkconfig_core/layer_watcher.h"
+
+#include <QObject>
+#include <QLocalServer>
+#include <QLocalSocket>
+
+#include <string>
+
+// Keep the layers and the layers configurations loaded and apply the LayersBatch commands received on a local socket.
+class LayersDaemon : public QObject {
+    Q_OBJECT
+
+   public:
+    LayersDaemon(Environment& environment);
+
+    bool Listen(const std::string& server_name);
+
+   public Q_SLOTS:
+    void OnNewConnection();
+    void OnReadyRead();
+    void OnLayersChanged();
+
+   private:
+    LayersDaemon(const LayersDaemon&) = delete;
+    LayersDaemon& operator=(const LayersDaemon&) = delete;
+
+    Environment& environment;
+    LayersBatch batch;
+    QLocalServer server;
+    LayerWatcher watcher;
+};
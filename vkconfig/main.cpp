@@ -22,6 +22,7 @@
 #include "main_reset.h"
 #include "main_layers.h"
 #include "main_doc.h"
+#include "main_daemon.h"
 #include "main_signal.h"
 
 #include "../vkconfig_core/command_line.h"
@@ -61,6 +62,9 @@ int main(int argc, char* argv[]) {
         case COMMAND_DOC: {
             return run_doc(command_line);
         }
+        case COMMAND_DAEMON: {
+            return run_daemon(argc, argv, command_line);
+        }
         default: {
             assert(0);
             return -1;
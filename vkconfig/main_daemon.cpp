@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "main_daemon.h"
+#include "layers_daemon.h"
+
+#include "../vkconfig_core/version.h"
+
+#include <QCoreApplication>
+
+#include <cassert>
+#include <cstdio>
+
+int run_daemon(int argc, char* argv[], const CommandLine& command_line) {
+    assert(command_line.command == COMMAND_DAEMON);
+    assert(command_line.error == ERROR_NONE);
+
+    QCoreApplication::setOrganizationName("LunarG");
+    QCoreApplication::setOrganizationDomain("lunarg.com");
+    QCoreApplication::setApplicationName(VKCONFIG_SHORT_NAME);
+
+    QCoreApplication app(argc, argv);
+
+    PathManager paths(command_line.command_vulkan_sdk);
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    int result = -1;
+    {
+        LayersDaemon daemon(environment);
+        if (daemon.Listen(command_line.daemon_server_name)) {
+            result = app.exec();
+        } else {
+            printf("\nFailed to listen on \"%s\"...\n", command_line.daemon_server_name.c_str());
+        }
+    }
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+
+    return result;
+}
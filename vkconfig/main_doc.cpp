@@ -33,8 +33,8 @@ int run_doc_html(const CommandLine& command_line) {
     LayerManager layers(environment);
     layers.LoadAllInstalledLayers();
 
-    for (std::size_t i = 0, n = layers.available_layers.size(); i < n; ++i) {
-        const Layer& layer = layers.available_layers[i];
+    for (std::size_t i = 0, n = layers.GetLayers().size(); i < n; ++i) {
+        const Layer& layer = layers.GetLayers()[i];
         if (layer.key == command_line.doc_layer_name) {
             const std::string path = format("%s/%s.html", command_line.doc_out_dir.c_str(), layer.key.c_str());
             ExportHtmlDoc(layer, path);
@@ -54,8 +54,8 @@ int run_doc_markdown(const CommandLine& command_line) {
     LayerManager layers(environment);
     layers.LoadAllInstalledLayers();
 
-    for (std::size_t i = 0, n = layers.available_layers.size(); i < n; ++i) {
-        const Layer& layer = layers.available_layers[i];
+    for (std::size_t i = 0, n = layers.GetLayers().size(); i < n; ++i) {
+        const Layer& layer = layers.GetLayers()[i];
         if (layer.key == command_line.doc_layer_name) {
             const std::string path = format("%s/%s.md", command_line.doc_out_dir.c_str(), layer.key.c_str());
             ExportMarkdownDoc(layer, path);
@@ -78,20 +78,36 @@ int run_doc_settings(const CommandLine& command_line) {
     Layer* layer;
 
     layers.LoadLayer(command_line.doc_layer_name);
-    layer = FindByKey(layers.available_layers, command_line.doc_layer_name.c_str());
+    layer = layers.FindLayer(command_line.doc_layer_name);
     if (!layer) {
         fprintf(stderr, "vkconfig: Could not load layer %s\n", command_line.doc_layer_name.c_str());
         fprintf(stderr, "Run \"vkconfig layers --list\" to get list of available layers\n");
         return -1;
     }
-    config = configuration_manager.CreateConfiguration(layers.available_layers, "Config");
-    config.parameters = GatherParameters(config.parameters, layers.available_layers);
+    config = configuration_manager.CreateConfiguration(layers.GetLayers(), "Config");
+    config.parameters = GatherParameters(config.parameters, layers.GetLayers());
     config.parameters[0].state = LAYER_STATE_OVERRIDDEN;
-    ExportSettingsDoc(layers.available_layers, config, command_line.doc_out_dir + "/vk_layer_settings.txt");
+    ExportSettingsDoc(layers.GetLayers(), config, command_line.doc_out_dir + "/vk_layer_settings.txt");
 
     return rval;
 }
 
+int run_doc_all(const CommandLine& command_line) {
+    PathManager paths(command_line.command_vulkan_sdk);
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layers(environment);
+    layers.LoadAllInstalledLayers();
+
+    if (layers.GetLayers().empty()) {
+        fprintf(stderr, "vkconfig: No Vulkan layer found\n");
+        return -1;
+    }
+
+    return ExportAllDoc(layers.GetLayers(), command_line.doc_out_dir) ? 0 : -1;
+}
+
 int run_doc(const CommandLine& command_line) {
     assert(command_line.command == COMMAND_DOC);
     assert(command_line.error == ERROR_NONE);
@@ -106,6 +122,9 @@ int run_doc(const CommandLine& command_line) {
         case COMMAND_DOC_SETTINGS: {
             return run_doc_settings(command_line);
         }
+        case COMMAND_DOC_ALL: {
+            return run_doc_all(command_line);
+        }
         default: {
             assert(0);
             return -1;
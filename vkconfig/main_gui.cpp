@@ -25,6 +25,7 @@
 #include "../vkconfig_core/alert.h"
 #include "../vkconfig_core/version.h"
 #include "../vkconfig_core/application_singleton.h"
+#include "../vkconfig_core/override.h"
 
 #include <QApplication>
 #include <QCheckBox>
@@ -53,6 +54,10 @@ int run_gui(int argc, char* argv[], const CommandLine& command_line) {
         QCoreApplication::setAttribute((Qt::ApplicationAttribute)20);
     }
 
+    // The Vulkan installation is queried by Vulkan Configurator and its probes without the layers override, so that the
+    // override files remain in place for the Vulkan applications running meanwhile
+    qputenv(GetDisableOverrideVariable(), "1");
+
     QApplication app(argc, argv);
 
     // This has to go after the construction of QApplication in
@@ -24,7 +24,14 @@
 #include "../vkconfig_core/override.h"
 #include "../vkconfig_core/layer_manager.h"
 
+#include "layers_batch.h"
+
+#include <QFile>
+#include <QTextStream>
+#include <QElapsedTimer>
+
 #include <cassert>
+#include <cstdio>
 
 static int RunLayersOverride(const CommandLine& command_line) {
     PathManager paths(command_line.command_vulkan_sdk);
@@ -35,7 +42,7 @@ static int RunLayersOverride(const CommandLine& command_line) {
     layers.LoadAllInstalledLayers();
 
     Configuration configuration;
-    const bool load_result = configuration.Load(layers.available_layers, command_line.layers_configuration_path.c_str());
+    const bool load_result = configuration.Load(layers.GetLayers(), command_line.layers_configuration_path.c_str());
     if (!load_result) {
         printf("\nFailed to load the layers configuration file...\n");
         return -1;
@@ -45,7 +52,7 @@ static int RunLayersOverride(const CommandLine& command_line) {
     const bool use_application_list = environment.UseApplicationListOverrideMode();
     environment.SetMode(OVERRIDE_MODE_LIST, false);
 
-    const bool override_result = OverrideConfiguration(environment, layers.available_layers, configuration);
+    const bool override_result = OverrideConfiguration(environment, layers.GetLayers(), configuration);
 
     environment.SetMode(OVERRIDE_MODE_LIST, use_application_list);
 
@@ -98,13 +105,13 @@ static int RunLayersList(const CommandLine& command_line) {
     environment.Reset(Environment::DEFAULT);
 
     LayerManager layers(environment);
-    layers.LoadAllInstalledLayers();
+    layers.LoadAllInstalledLayers(LAYER_LOAD_HEADER);  // Settings are not listed
 
-    if (layers.available_layers.empty()) {
+    if (layers.GetLayers().empty()) {
         printf("No Vulkan layer found\n");
     } else {
-        for (std::size_t i = 0, n = layers.available_layers.size(); i < n; ++i) {
-            const Layer& layer = layers.available_layers[i];
+        for (std::size_t i = 0, n = layers.GetLayers().size(); i < n; ++i) {
+            const Layer& layer = layers.GetLayers()[i];
 
             printf("%s\n", layer.key.c_str());
         }
@@ -119,10 +126,10 @@ static int RunLayersVerbose(const CommandLine& command_line) {
     environment.Reset(Environment::DEFAULT);
 
     LayerManager layers(environment);
-    layers.LoadAllInstalledLayers();
+    layers.LoadAllInstalledLayers(LAYER_LOAD_HEADER);  // Settings are not listed
 
-    for (std::size_t i = 0, n = layers.available_layers.size(); i < n; ++i) {
-        const Layer& layer = layers.available_layers[i];
+    for (std::size_t i = 0, n = layers.GetLayers().size(); i < n; ++i) {
+        const Layer& layer = layers.GetLayers()[i];
 
         printf("%s (%s) %s-%s\n", layer.key.c_str(), GetLayerTypeLabel(layer.type), layer.api_version.str().c_str(),
                layer.implementation_version.c_str());
@@ -134,6 +141,72 @@ static int RunLayersVerbose(const CommandLine& command_line) {
     return 0;
 }
 
+static int RunLayersBatch(const CommandLine& command_line) {
+    QFile file;
+    bool open_result = false;
+    if (command_line.layers_script_path == "-") {
+        open_result = file.open(stdin, QIODevice::ReadOnly | QIODevice::Text);
+    } else {
+        file.setFileName(command_line.layers_script_path.c_str());
+        open_result = file.open(QIODevice::ReadOnly | QIODevice::Text);
+    }
+
+    if (!open_result) {
+        printf("\nFailed to open the layers script file...\n");
+        return -1;
+    }
+
+    PathManager paths(command_line.command_vulkan_sdk);
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    QElapsedTimer timer;
+    timer.start();
+
+    LayersBatch batch(environment);
+
+    printf("Loaded %d Vulkan layers (%.3f ms)\n", static_cast<int>(batch.GetLayers().size()), timer.nsecsElapsed() / 1000000.0);
+    fflush(stdout);
+
+    int failure_count = 0;
+    int line_index = 0;
+
+    QTextStream stream(&file);
+    while (!stream.atEnd()) {
+        const QString line = stream.readLine().trimmed();
+        ++line_index;
+
+        timer.restart();
+        const BatchResult result = batch.Run(line.toStdString());
+        const double elapsed = timer.nsecsElapsed() / 1000000.0;
+
+        switch (result) {
+            case BATCH_SUCCESS:
+                printf("[%d] %s: done (%.3f ms)\n", line_index, line.toStdString().c_str(), elapsed);
+                break;
+            case BATCH_FAILURE:
+                printf("[%d] %s: failed (%.3f ms)\n", line_index, line.toStdString().c_str(), elapsed);
+                ++failure_count;
+                break;
+            case BATCH_INVALID:
+                printf("[%d] %s: invalid command\n", line_index, line.toStdString().c_str());
+                ++failure_count;
+                break;
+            case BATCH_IGNORED:
+                continue;
+        }
+        fflush(stdout);  // Report each step as soon as it's done when a test runner is reading the output
+    }
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+
+    if (failure_count > 0) {
+        printf("\n%d layers script command(s) failed...\n", failure_count);
+    }
+
+    return failure_count == 0 ? 0 : -1;
+}
+
 int run_layers(const CommandLine& command_line) {
     assert(command_line.command == COMMAND_LAYERS);
     assert(command_line.error == ERROR_NONE);
@@ -151,6 +224,9 @@ int run_layers(const CommandLine& command_line) {
         case COMMAND_LAYERS_VERBOSE: {
             return RunLayersVerbose(command_line);
         }
+        case COMMAND_LAYERS_BATCH: {
+            return RunLayersBatch(command_line);
+        }
         default: {
             assert(0);
             return -1;
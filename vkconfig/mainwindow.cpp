@@ -37,8 +37,10 @@
 #include "../vkconfig_core/help.h"
 #include "../vkconfig_core/doc.h"
 #include "../vkconfig_core/date.h"
+#include "../vkconfig_core/override.h"
 
 #include <QProcess>
+#include <QProcessEnvironment>
 #include <QMessageBox>
 #include <QFrame>
 #include <QComboBox>
@@ -47,6 +49,9 @@
 #include <QLineEdit>
 #include <QSettings>
 #include <QDesktopServices>
+#include <QProgressDialog>
+#include <QStatusBar>
+#include <QApplication>
 
 #if VKC_PLATFORM == VKC_PLATFORM_LINUX || VKC_PLATFORM == VKC_PLATFORM_MACOS
 #include <unistd.h>
@@ -54,6 +59,12 @@
 
 #include <cassert>
 
+static const int LOG_MAX_BLOCK_COUNT = 2048;
+static const int LOG_FLUSH_INTERVAL = 1000;  // In milliseconds
+static const int LAUNCH_UPDATE_INTERVAL = 33;  // In milliseconds, about 30 updates per second
+static const int LAYERS_CHANGED_RETRY_DELAY = 500;  // In milliseconds
+static const int APPLICATIONS_SYNC_INTERVAL = 100;  // In milliseconds
+
 static const int LAUNCH_COLUMN0_SIZE = 220;
 static const int LAUNCH_COLUMN2_SIZE = 32;
 static const int LAUNCH_SPACING_SIZE = 2;
@@ -67,6 +78,7 @@ MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent),
       _launch_application(nullptr),
       _log_file(nullptr),
+      _layer_watcher(Configurator::Get().layers),
       _launcher_apps_combo(nullptr),
       _launcher_executable(nullptr),
       _launcher_arguments(nullptr),
@@ -78,6 +90,8 @@ MainWindow::MainWindow(QWidget *parent)
       _launcher_log_file_browse_button(nullptr),
       ui(new Ui::MainWindow),
       been_warned_about_old_loader(false) {
+    this->vulkan_probes.fill(nullptr);
+
     ui->setupUi(this);
     ui->launcher_tree->installEventFilter(this);
     ui->configuration_tree->installEventFilter(this);
@@ -129,7 +143,20 @@ MainWindow::MainWindow(QWidget *parent)
     // Whenever the control surpasses this block count, old blocks are discarded.
     // Note: We could make this a user configurable setting down the road should this be
     // insufficinet.
-    ui->log_browser->document()->setMaximumBlockCount(2048);
+    ui->log_browser->document()->setMaximumBlockCount(LOG_MAX_BLOCK_COUNT);
+
+    _log_flush_timer.setSingleShot(true);
+    _log_flush_timer.setInterval(LOG_FLUSH_INTERVAL);
+    connect(&_log_flush_timer, SIGNAL(timeout()), this, SLOT(OnLogFileFlush()));
+
+    _launch_update_timer.setInterval(LAUNCH_UPDATE_INTERVAL);
+    connect(&_launch_update_timer, SIGNAL(timeout()), this, SLOT(OnLaunchUpdate()));
+    connect(&_layer_watcher, SIGNAL(LayersChanged()), this, SLOT(OnLayersChanged()));
+
+    // The applications executables are searched on a worker thread, the GUI thread never waits for the search
+    _applications_sync_timer.setInterval(APPLICATIONS_SYNC_INTERVAL);
+    connect(&_applications_sync_timer, SIGNAL(timeout()), this, SLOT(OnApplicationsSync()));
+    _applications_sync_timer.start();
     ui->configuration_tree->scrollToItem(ui->configuration_tree->topLevelItem(0), QAbstractItemView::PositionAtTop);
 
     if (configurator.configurations.HasSelectConfiguration()) {
@@ -268,17 +295,22 @@ void MainWindow::UpdateUI() {
     if (configurator.request_vulkan_status) {
         ui->log_browser->clear();
 
-        ui->log_browser->setPlainText(("Vulkan Development Status:\n" + GenerateVulkanStatus()).c_str());
+        ui->log_browser->setPlainText("Vulkan Development Status:\n- Searching the Vulkan installation...\n");
         ui->push_button_clear_log->setEnabled(true);
+
+        // The Vulkan installation changed, vulkaninfo and vkvia outputs are outdated
+        ReleaseVulkanProbe(VULKAN_PROBE_INFO);
+        ReleaseVulkanProbe(VULKAN_PROBE_ANALYSIS);
+        StartVulkanProbe(VULKAN_PROBE_STATUS);
         configurator.request_vulkan_status = false;
 
-        if (configurator.configurations.HasActiveConfiguration(configurator.layers.available_layers)) {
+        if (configurator.configurations.HasActiveConfiguration(configurator.layers.GetLayers())) {
             _settings_tree_manager.CreateGUI(ui->settings_tree);
         }
     }
 
     // Update title bar
-    setWindowTitle(GetMainWindowTitle(configurator.configurations.HasActiveConfiguration(configurator.layers.available_layers) &&
+    setWindowTitle(GetMainWindowTitle(configurator.configurations.HasActiveConfiguration(configurator.layers.GetLayers()) &&
                                       configurator.environment.UseOverride())
                        .c_str());
 
@@ -302,7 +334,7 @@ void MainWindow::LoadConfigurationList() {
         const Configuration &configuration = configurator.configurations.available_configurations[i];
 
         // Hide built-in configuration when the layer is missing. The Vulkan user may have not installed the necessary layer
-        // if (configuration.IsBuiltIn() && HasMissingLayer(configuration.parameters, configurator.layers.available_layers))
+        // if (configuration.IsBuiltIn() && HasMissingLayer(configuration.parameters, configurator.layers.GetLayers()))
         // continue;
 
         ConfigurationListItem *item = new ConfigurationListItem(configuration.key);
@@ -321,13 +353,53 @@ void MainWindow::LoadConfigurationList() {
     ui->configuration_tree->resizeColumnToContents(0);
     ui->configuration_tree->resizeColumnToContents(1);
 
-    if (configurator.configurations.HasActiveConfiguration(configurator.layers.available_layers)) {
+    if (configurator.configurations.HasActiveConfiguration(configurator.layers.GetLayers())) {
         _settings_tree_manager.CreateGUI(ui->settings_tree);
     }
 
     this->UpdateUI();
 }
 
+void MainWindow::OnApplicationsSync() {
+    // The applications dialog refers to the applications by index, the list is synced when it is closed
+    if (QApplication::activeModalWidget() != nullptr) return;
+
+    if (!Configurator::Get().environment.SyncApplications(false)) return;
+
+    _applications_sync_timer.stop();
+
+    this->UpdateUI();
+}
+
+void MainWindow::OnLayersChanged() {
+    // Dialogs edit copies of the configurations, the layers are updated when they are closed
+    if (QApplication::activeModalWidget() != nullptr) {
+        QTimer::singleShot(LAYERS_CHANGED_RETRY_DELAY, this, SLOT(OnLayersChanged()));
+        return;
+    }
+
+    // The directories changes still waiting to be scanned or loaded are notified again once loaded
+    if (!_layer_watcher.HasLoadedChanges()) return;
+
+    _settings_tree_manager.CleanupGUI();
+
+    Configurator &configurator = Configurator::Get();
+
+    const std::vector<std::string> &updated_layers = _layer_watcher.Apply(false);
+
+    // The manifests were loaded on a worker thread, their errors are shown here
+    const std::vector<LayerManifestError> &errors = _layer_watcher.GetErrors();
+    for (std::size_t i = 0, n = errors.size(); i < n; ++i) {
+        Alert::LayerInvalid(errors[i].manifest_path.c_str(), errors[i].message.c_str());
+    }
+
+    configurator.configurations.RefreshLayers(configurator.layers.GetLayers(), updated_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
+    configurator.request_vulkan_status = true;
+
+    LoadConfigurationList();
+}
+
 /// Okay, because we are using custom controls, some of
 /// the signaling is not happening as expected. So, we cannot
 /// always get an accurate answer to the currently selected
@@ -350,7 +422,7 @@ void MainWindow::on_radio_override_clicked() {
     Configurator &configurator = Configurator::Get();
 
     configurator.environment.SetMode(OVERRIDE_MODE_ACTIVE, true);
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
     configurator.request_vulkan_status = true;
 
     UpdateUI();
@@ -361,7 +433,7 @@ void MainWindow::on_radio_fully_clicked() {
     Configurator &configurator = Configurator::Get();
 
     configurator.environment.SetMode(OVERRIDE_MODE_ACTIVE, false);
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
     configurator.request_vulkan_status = true;
 
     UpdateUI();
@@ -399,7 +471,7 @@ void MainWindow::on_check_box_apply_list_clicked() {
         dialog.exec();
     }
 
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
 
     UpdateUI();
 }
@@ -417,8 +489,12 @@ void MainWindow::toolsResetToDefault(bool checked) {
 
     if (Alert::ConfiguratorResetAll() == QMessageBox::No) return;
 
+    _settings_tree_manager.CleanupGUI();
+
     Configurator &configurator = Configurator::Get();
+    const std::vector<std::string> search_paths = configurator.layers.GetSearchPaths();
     configurator.ResetToDefault(true);
+    this->ResetLayerWatcher(search_paths);
 
     LoadConfigurationList();
 
@@ -438,7 +514,7 @@ void MainWindow::OnConfigurationItemClicked(bool checked) {
     // to ensure the new item is "selected"
     ui->configuration_tree->setCurrentItem(item);
 
-    Configurator::Get().ActivateConfiguration(item->configuration_name);
+    this->ActivateConfiguration(item->configuration_name);
 
     UpdateUI();
 }
@@ -448,12 +524,35 @@ void MainWindow::OnConfigurationTreeClicked(QTreeWidgetItem *item, int column) {
 
     ConfigurationListItem *configuration_item = dynamic_cast<ConfigurationListItem *>(item);
     if (configuration_item != nullptr) {
-        Configurator::Get().ActivateConfiguration(configuration_item->configuration_name);
+        this->ActivateConfiguration(configuration_item->configuration_name);
     }
 
     UpdateUI();
 }
 
+void MainWindow::ActivateConfiguration(const std::string &configuration_name) {
+    Configurator &configurator = Configurator::Get();
+    if (configurator.environment.Get(ACTIVE_CONFIGURATION) == configuration_name) return;
+
+    // The settings tree refers to the layers and the configurations which are reloaded when the layers paths differ
+    _settings_tree_manager.CleanupGUI();
+
+    const std::vector<std::string> search_paths = configurator.layers.GetSearchPaths();
+    configurator.ActivateConfiguration(configuration_name);
+    this->ResetLayerWatcher(search_paths);
+
+    if (configurator.configurations.HasActiveConfiguration(configurator.layers.GetLayers())) {
+        _settings_tree_manager.CreateGUI(ui->settings_tree);
+    }
+}
+
+void MainWindow::ResetLayerWatcher(const std::vector<std::string> &previous_search_paths) {
+    // The layers of the previous user-defined paths were unloaded, their directories are no longer watched
+    if (Configurator::Get().layers.GetSearchPaths() != previous_search_paths) {
+        _layer_watcher.Reset();
+    }
+}
+
 /// An item has been changed. Check for edit of the items name (configuration name)
 void MainWindow::OnConfigurationItemChanged(QTreeWidgetItem *item, int column) {
     // This pointer will only be valid if it's one of the elements with
@@ -503,8 +602,8 @@ void MainWindow::OnConfigurationItemChanged(QTreeWidgetItem *item, int column) {
             // Rename configuration ; Remove old configuration file ; change the name of the configuration
             configurator.configurations.RemoveConfigurationFile(old_name);
             configuration->key = configuration_item->configuration_name = new_name;
-            configurator.configurations.SaveAllConfigurations(configurator.layers.available_layers);
-            configurator.configurations.LoadAllConfigurations(configurator.layers.available_layers);
+            configurator.configurations.SaveAllConfigurations(configurator.layers.GetLayers());
+            configurator.configurations.LoadAllConfigurations(configurator.layers.GetLayers());
 
             configurator.ActivateConfiguration(new_name);
 
@@ -528,7 +627,7 @@ void MainWindow::OnConfigurationTreeChanged(QTreeWidgetItem *current, QTreeWidge
     if (configuration_item == nullptr) return;
 
     Configurator &configurator = Configurator::Get();
-    if (configurator.configurations.HasActiveConfiguration(configurator.layers.available_layers)) {
+    if (configurator.configurations.HasActiveConfiguration(configurator.layers.GetLayers())) {
         if (configurator.configurations.GetActiveConfiguration()->key == configuration_item->configuration_name) return;
     }
 
@@ -550,27 +649,81 @@ void MainWindow::OnHelpAbout(bool checked) {
     dlg.exec();
 }
 
+void MainWindow::ReleaseVulkanProbe(VulkanProbeTask task) {
+    VulkanProbe *probe = this->vulkan_probes[task];
+    if (probe == nullptr) return;
+
+    this->vulkan_probes[task] = nullptr;
+
+    // The results of a running probe are outdated, it's deleted once it's done
+    disconnect(probe, nullptr, this, nullptr);
+    if (probe->isRunning()) {
+        probe->requestInterruption();
+        connect(probe, SIGNAL(finished()), probe, SLOT(deleteLater()));
+    } else {
+        probe->deleteLater();
+    }
+}
+
+VulkanProbe *MainWindow::StartVulkanProbe(VulkanProbeTask task) {
+    ReleaseVulkanProbe(task);
+
+    // The probes run with the layers override disabled by their environment, see run_gui
+    VulkanProbe *probe = new VulkanProbe(task, this);
+    connect(probe, SIGNAL(finished()), this, SLOT(OnVulkanProbeFinished()));
+    this->vulkan_probes[task] = probe;
+
+    probe->start();
+    return probe;
+}
+
+void MainWindow::OnVulkanProbeFinished() {
+    VulkanProbe *probe = qobject_cast<VulkanProbe *>(sender());
+    assert(probe != nullptr);
+
+    if (probe->GetTask() == VULKAN_PROBE_STATUS) {
+        ui->log_browser->setPlainText(("Vulkan Development Status:\n" + GenerateVulkanStatus(*probe)).c_str());
+    }
+}
+
 void MainWindow::StartTool(Tool tool) {
-    std::string active_configuration;
+    const VulkanProbeTask task = tool == TOOL_VULKAN_INFO ? VULKAN_PROBE_INFO : VULKAN_PROBE_ANALYSIS;
 
-    Configurator &configurator = Configurator::Get();
-    if (configurator.configurations.HasActiveConfiguration(configurator.layers.available_layers)) {
-        active_configuration = configurator.configurations.GetActiveConfiguration()->key;
-        configurator.configurations.SetActiveConfiguration(configurator.layers.available_layers, nullptr);
+    // The tool output is reused until the Vulkan installation changes, unless the tool failed
+    VulkanProbe *probe = this->vulkan_probes[task];
+    if (probe == nullptr || (probe->isFinished() && probe->GetResult() != VULKAN_PROBE_SUCCESS)) {
+        probe = StartVulkanProbe(task);
+    }
+
+    if (!probe->isFinished()) {
+        QProgressDialog progress(tool == TOOL_VULKAN_INFO ? "Running vulkaninfo..." : "Running vkvia...", "Cancel", 0,
+                                 probe->GetStepCount(), this);
+        progress.setWindowModality(Qt::WindowModal);
+        progress.setMinimumDuration(0);
+        progress.setAutoReset(false);  // Closed when the probe finished, not on the last step
+
+        connect(probe, SIGNAL(ProgressChanged(int)), &progress, SLOT(setValue(int)));
+        connect(probe, SIGNAL(finished()), &progress, SLOT(reset()));
+
+        // The probe may have finished before the signals were connected
+        if (!probe->isFinished()) {
+            progress.exec();
+        }
+
+        if (progress.wasCanceled() || !probe->isFinished()) {
+            probe->requestInterruption();
+            return;
+        }
     }
 
     switch (tool) {
         case TOOL_VULKAN_INFO:
-            vk_info_dialog.reset(new VulkanInfoDialog(this));
+            vk_info_dialog.reset(new VulkanInfoDialog(this, *probe));
             break;
         case TOOL_VULKAN_INSTALL:
-            vk_installation_dialog.reset(new VulkanAnalysisDialog(this));
+            vk_installation_dialog.reset(new VulkanAnalysisDialog(this, *probe));
             break;
     }
-
-    if (!active_configuration.empty()) {
-        configurator.configurations.SetActiveConfiguration(configurator.layers.available_layers, active_configuration);
-    }
 }
 
 /// Create the VulkanInfo dialog if it doesn't already exits & show it.
@@ -698,7 +851,7 @@ void MainWindow::on_push_button_applications_clicked() {
     dlg.exec();
 
     Configurator &configurator = Configurator::Get();
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
 
     UpdateUI();
 }
@@ -718,9 +871,9 @@ void MainWindow::on_push_button_duplicate_clicked() {
     assert(configutation != nullptr);
 
     const Configuration &duplicated_configuration =
-        configurator.configurations.CreateConfiguration(configurator.layers.available_layers, configutation->key, true);
+        configurator.configurations.CreateConfiguration(configurator.layers.GetLayers(), configutation->key, true);
 
-    configurator.ActivateConfiguration(duplicated_configuration.key);
+    this->ActivateConfiguration(duplicated_configuration.key);
 
     LoadConfigurationList();
 }
@@ -732,10 +885,15 @@ void MainWindow::on_push_button_edit_clicked() {
 
     const std::string configuration_name = configuration->key;
 
+    // The layers dialog may reload the layers and the configurations
+    _settings_tree_manager.CleanupGUI();
+
+    const std::vector<std::string> search_paths = configurator.layers.GetSearchPaths();
     LayersDialog dlg(this, *configuration);
-    if (dlg.exec() == QDialog::Accepted) {
-        LoadConfigurationList();
-    }
+    dlg.exec();
+    this->ResetLayerWatcher(search_paths);
+
+    LoadConfigurationList();
 }
 
 // Edit the layers for the given configuration.
@@ -748,32 +906,43 @@ void MainWindow::EditClicked(ConfigurationListItem *item) {
         FindByKey(configurator.configurations.available_configurations, item->configuration_name.c_str());
     assert(configuration != nullptr);
 
+    // The layers dialog may reload the layers and the configurations
+    _settings_tree_manager.CleanupGUI();
+
+    const std::vector<std::string> search_paths = configurator.layers.GetSearchPaths();
     LayersDialog dlg(this, *configuration);
-    if (dlg.exec() == QDialog::Accepted) {
-        LoadConfigurationList();
-    }
+    dlg.exec();
+    this->ResetLayerWatcher(search_paths);
+
+    LoadConfigurationList();
 }
 
 void MainWindow::NewClicked() {
     Configurator &configurator = Configurator::Get();
     const std::string active_configuration = configurator.environment.Get(ACTIVE_CONFIGURATION);
 
+    // The new configuration may reallocate the configurations and the layers dialog may reload them
+    _settings_tree_manager.CleanupGUI();
+
     Configuration &new_configuration =
-        configurator.configurations.CreateConfiguration(configurator.layers.available_layers, "New Configuration");
+        configurator.configurations.CreateConfiguration(configurator.layers.GetLayers(), "New Configuration");
 
+    const std::vector<std::string> search_paths = configurator.layers.GetSearchPaths();
     LayersDialog dlg(this, new_configuration);
     switch (dlg.exec()) {
         case QDialog::Accepted:
             break;
         case QDialog::Rejected:
-            configurator.configurations.RemoveConfiguration(configurator.layers.available_layers, new_configuration.key);
-            configurator.configurations.SetActiveConfiguration(configurator.layers.available_layers, active_configuration);
+            configurator.configurations.RemoveConfiguration(configurator.layers.GetLayers(), new_configuration.key);
+            configurator.configurations.SetActiveConfiguration(configurator.layers.GetLayers(), active_configuration);
             break;
         default:
             assert(0);
             break;
     }
 
+    this->ResetLayerWatcher(search_paths);
+
     LoadConfigurationList();
 }
 
@@ -793,7 +962,7 @@ void MainWindow::RemoveConfiguration(const std::string &configuration_name) {
     _settings_tree_manager.CleanupGUI();
 
     Configurator &configurator = Configurator::Get();
-    configurator.configurations.RemoveConfiguration(configurator.layers.available_layers, configuration_name);
+    configurator.configurations.RemoveConfiguration(configurator.layers.GetLayers(), configuration_name);
     configurator.request_vulkan_status = true;
     LoadConfigurationList();
 }
@@ -833,7 +1002,7 @@ void MainWindow::ResetClicked(ConfigurationListItem *item) {
     alert.setIcon(QMessageBox::Warning);
     if (alert.exec() == QMessageBox::No) return;
 
-    configuration->Reset(configurator.layers.available_layers, configurator.path);
+    configuration->Reset(configurator.layers.GetLayers(), configurator.path);
 
     LoadConfigurationList();
 }
@@ -850,11 +1019,11 @@ void MainWindow::DuplicateClicked(ConfigurationListItem *item) {
 
     Configurator &configurator = Configurator::Get();
     const Configuration &duplicated_configuration =
-        configurator.configurations.CreateConfiguration(configurator.layers.available_layers, item->configuration_name, true);
+        configurator.configurations.CreateConfiguration(configurator.layers.GetLayers(), item->configuration_name, true);
 
     item->configuration_name = duplicated_configuration.key;
 
-    configurator.ActivateConfiguration(duplicated_configuration.key);
+    this->ActivateConfiguration(duplicated_configuration.key);
 
     LoadConfigurationList();
 
@@ -880,7 +1049,7 @@ void MainWindow::ImportClicked(ConfigurationListItem *item) {
     const std::string full_import_path = configurator.path.SelectPath(this, PATH_IMPORT_CONFIGURATION);
     if (full_import_path.empty()) return;
 
-    configurator.configurations.ImportConfiguration(configurator.layers.available_layers, full_import_path);
+    configurator.configurations.ImportConfiguration(configurator.layers.GetLayers(), full_import_path);
     LoadConfigurationList();
 }
 
@@ -893,7 +1062,7 @@ void MainWindow::ExportClicked(ConfigurationListItem *item) {
     const std::string full_export_path = configurator.path.SelectPath(this, PATH_EXPORT_CONFIGURATION, full_suggested_path);
     if (full_export_path.empty()) return;
 
-    configurator.configurations.ExportConfiguration(configurator.layers.available_layers, full_export_path,
+    configurator.configurations.ExportConfiguration(configurator.layers.GetLayers(), full_export_path,
                                                     item->configuration_name);
 }
 
@@ -904,7 +1073,7 @@ void MainWindow::ReloadDefaultClicked(ConfigurationListItem *item) {
         _settings_tree_manager.CleanupGUI();
 
         Configurator &configurator = Configurator::Get();
-        configurator.configurations.ReloadDefaultsConfigurations(configurator.layers.available_layers);
+        configurator.configurations.ReloadDefaultsConfigurations(configurator.layers.GetLayers());
 
         LoadConfigurationList();
         _settings_tree_manager.CreateGUI(ui->settings_tree);
@@ -927,7 +1096,7 @@ void MainWindow::OnSettingsTreeClicked(QTreeWidgetItem *item, int column) {
     (void)item;
 
     Configurator &configurator = Configurator::Get();
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
 
     this->UpdateUI();
 }
@@ -1177,8 +1346,8 @@ const Layer *GetLayer(QTreeWidget *tree, QTreeWidgetItem *item) {
     if (!text.empty()) {
         Configurator &configurator = Configurator::Get();
 
-        for (std::size_t i = 0, n = configurator.layers.available_layers.size(); i < n; ++i) {
-            const Layer &layer = configurator.layers.available_layers[i];
+        for (std::size_t i = 0, n = configurator.layers.GetLayers().size(); i < n; ++i) {
+            const Layer &layer = configurator.layers.GetLayers()[i];
             if (text.find(layer.key) != std::string::npos) return &layer;
         }
     }
@@ -1417,18 +1586,23 @@ bool MainWindow::SelectConfigurationItem(const std::string &configuration_name)
 
 void MainWindow::ResetLaunchApplication() {
     if (_launch_application) {
-        _launch_application->kill();
-        _launch_application->waitForFinished();
-        _launch_application.reset();
+        disconnect(_launch_application.get(), SIGNAL(finished()), this, SLOT(OnLaunchFinished()));
+
+        _launch_application->requestInterruption();
+        _launch_application->wait();
 
-        UpdateUI();
+        OnLaunchFinished();
     }
 }
 
 QStringList MainWindow::BuildEnvVariables() const {
     Configurator &configurator = Configurator::Get();
 
-    QStringList env = QProcess::systemEnvironment();
+    // The launched application uses the layers override, unlike Vulkan Configurator and its probes
+    QProcessEnvironment process_environment = QProcessEnvironment::systemEnvironment();
+    process_environment.remove(GetDisableOverrideVariable());
+
+    QStringList env = process_environment.toStringList();
     env << (QString("VK_LOADER_DEBUG=") + GetLoaderDebugToken(configurator.environment.GetLoaderMessage()).c_str());
     return env;
 }
@@ -1440,6 +1614,9 @@ void MainWindow::on_push_button_launcher_clicked() {
         return;
     }
 
+    // Make sure the application is launched with the latest setting edits
+    _settings_tree_manager.FlushRefreshConfiguration();
+
     // We are logging, let's add that we've launched a new application
     std::string launch_log = "Launching Vulkan Application:\n";
 
@@ -1451,7 +1628,7 @@ void MainWindow::on_push_button_launcher_clicked() {
     std::string missing_layer;
     if (configuration == nullptr) {
         launch_log += "- Layers fully controlled by the application.\n";
-    } else if (HasMissingLayer(configuration->parameters, configurator.layers.available_layers, missing_layer)) {
+    } else if (HasMissingLayer(configuration->parameters, configurator.layers.GetLayers(), missing_layer)) {
         launch_log += format("- No layers override. The active \"%s\" configuration is missing '%s' layer.\n",
                              configuration->key.c_str(), missing_layer.c_str());
     } else if (configurator.environment.UseOverride()) {
@@ -1495,85 +1672,98 @@ void MainWindow::on_push_button_launcher_clicked() {
     if (ui->check_box_clear_on_launch->isChecked()) ui->log_browser->clear();
     Log(launch_log.c_str());
 
-    // Launch the test application
-    _launch_application.reset(new QProcess(this));
-    connect(_launch_application.get(), SIGNAL(readyReadStandardOutput()), this, SLOT(standardOutputAvailable()));
-    connect(_launch_application.get(), SIGNAL(readyReadStandardError()), this, SLOT(errorOutputAvailable()));
-    connect(_launch_application.get(), SIGNAL(finished(int, QProcess::ExitStatus)), this,
-            SLOT(processClosed(int, QProcess::ExitStatus)));
-
-    _launch_application->setProgram(active_application.executable_path.c_str());
-    _launch_application->setWorkingDirectory(active_application.working_folder.c_str());
-    _launch_application->setEnvironment(BuildEnvVariables());
+    // From now on, the log file is only written by the capture thread until the application is terminated
+    _log_flush_timer.stop();
+    OnLogFileFlush();
 
+    QStringList args;
     if (!active_application.arguments.empty()) {
-        const QStringList args = QString(active_application.arguments.c_str()).split(" ");
-        _launch_application->setArguments(args);
+        args = QString(active_application.arguments.c_str()).split(" ");
     }
 
-    _launch_application->start(QIODevice::ReadOnly | QIODevice::Unbuffered);
-    _launch_application->setProcessChannelMode(QProcess::MergedChannels);
-    _launch_application->closeWriteChannel();
-
-    // Wait... did we start? Give it 4 seconds, more than enough time
-    if (!_launch_application->waitForStarted(4000)) {
-        _launch_application->deleteLater();
-        _launch_application = nullptr;
+    // Launch the test application
+    _launch_application.reset(new LaunchCapture(active_application.executable_path.c_str(), args,
+                                                active_application.working_folder.c_str(), BuildEnvVariables(), &_log_file));
+    connect(_launch_application.get(), SIGNAL(finished()), this, SLOT(OnLaunchFinished()));
+    _launch_application->start();
 
-        const std::string failed_log = std::string("Failed to launch ") + active_application.executable_path.c_str() + "!\n";
-        Log(failed_log);
-    }
+    _launch_update_timer.start();
 
     UpdateUI();
 }
 
 /// The process we are following is closed. We don't actually care about the
-/// exit status/code, we just need to know to destroy the QProcess object
-/// and set it back to nullptr so that we know we can launch a new app.
+/// exit status/code, we just need to display the remaining output, destroy
+/// the capture thread so that we know we can launch a new app.
 /// Also, if we are logging, it's time to close the log file.
-void MainWindow::processClosed(int exit_code, QProcess::ExitStatus status) {
-    (void)exit_code;
-    (void)status;
-
+void MainWindow::OnLaunchFinished() {
     assert(_launch_application);
 
-    disconnect(_launch_application.get(), SIGNAL(finished(int, QProcess::ExitStatus)), this,
-               SLOT(processClosed(int, QProcess::ExitStatus)));
-    disconnect(_launch_application.get(), SIGNAL(readyReadStandardError()), this, SLOT(errorOutputAvailable()));
-    disconnect(_launch_application.get(), SIGNAL(readyReadStandardOutput()), this, SLOT(standardOutputAvailable()));
+    _launch_application->wait();  // The signal is emitted right before the thread actually finishes
+
+    _launch_update_timer.stop();
+    OnLaunchUpdate();
 
-    Log("Process terminated");
+    if (_launch_application->GetState() == LAUNCH_FAILED) {
+        Log(format("Failed to launch %s!\n", _launch_application->GetProgram().toStdString().c_str()));
+    } else {
+        Log("Process terminated");
+    }
 
     if (_log_file.isOpen()) {
+        _log_flush_timer.stop();
         _log_file.close();
     }
 
-    ResetLaunchApplication();
+    _launch_application.reset();
+
+    UpdateUI();
 }
 
-/// This signal get's raised whenever the spawned Vulkan appliction writes
-/// to stdout and there is data to be read. The layers flush after all stdout
-/// writes, so we should see layer output here in realtime, as we just read
-/// the string and append it to the text browser.
-/// If a log file is open, we also write the output to the log.
-void MainWindow::standardOutputAvailable() {
-    if (_launch_application) {
-        Log(_launch_application->readAllStandardOutput().toStdString());
+/// The layers flush after all stdout writes and the capture thread reads the
+/// output as soon as it's available and writes it to the log file. The text
+/// browser is only updated at a capped rate with all the output captured since
+/// the previous update, so that a verbose application doesn't freeze the GUI.
+void MainWindow::OnLaunchUpdate() {
+    if (!_launch_application) return;
+
+    std::string output;
+    if (_launch_application->TakeOutput(output)) {
+        LogOutput(output);
     }
-}
 
-void MainWindow::errorOutputAvailable() {
-    if (_launch_application) {
-        Log(_launch_application->readAllStandardError().toStdString());
+    std::string status = format("%s: %d lines, %d bytes captured", _launch_application->GetProgram().toStdString().c_str(),
+                                static_cast<int>(_launch_application->GetLineCount()),
+                                static_cast<int>(_launch_application->GetByteCount()));
+    const std::size_t dropped_byte_count = _launch_application->GetDroppedByteCount();
+    if (dropped_byte_count > 0) {
+        status += format(", %d bytes only written to the log file", static_cast<int>(dropped_byte_count));
     }
+    statusBar()->showMessage(status.c_str());
 }
 
-void MainWindow::Log(const std::string &log) {
-    ui->log_browser->setPlainText(ui->log_browser->toPlainText() + "\n" + log.c_str());
+// The log is appended to the document, instead of replacing the whole text, and the document drops the oldest lines
+// beyond LOG_MAX_BLOCK_COUNT so that logging a large layer output takes a constant time per chunk.
+void MainWindow::LogOutput(const std::string &output) {
+    ui->log_browser->appendPlainText(output.c_str());
     ui->push_button_clear_log->setEnabled(true);
+}
 
-    if (_log_file.isOpen()) {
+void MainWindow::Log(const std::string &log) {
+    LogOutput(log);
+
+    // While an application is running, the log file belongs to the capture thread
+    if (_log_file.isOpen() && (!_launch_application || _launch_application->isFinished())) {
         _log_file.write(log.c_str(), log.size());
+
+        if (!_log_flush_timer.isActive()) {
+            _log_flush_timer.start();
+        }
+    }
+}
+
+void MainWindow::OnLogFileFlush() {
+    if (_log_file.isOpen()) {
         _log_file.flush();
     }
 }
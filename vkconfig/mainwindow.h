@@ -23,6 +23,10 @@
 
 #include "configurator.h"
 #include "settings_tree.h"
+#include "vulkan_probe.h"
+#include "launch_capture.h"
+
+#include "../vkconfig_core/layer_watcher.h"
 
 #include "ui_mainwindow.h"
 
@@ -34,7 +38,9 @@
 #include <QShowEvent>
 #include <QResizeEvent>
 #include <QProcess>
+#include <QTimer>
 
+#include <array>
 #include <memory>
 #include <string>
 
@@ -66,10 +72,16 @@ class MainWindow : public QMainWindow {
    private:
     SettingsTreeManager _settings_tree_manager;
 
-    std::unique_ptr<QProcess> _launch_application;  // Keeps track of the monitored app
-    QFile _log_file;                                // Log file for layer output
+    std::unique_ptr<LaunchCapture> _launch_application;  // Keeps track of the monitored app
+    QFile _log_file;                                     // Log file for layer output
+    QTimer _log_flush_timer;                             // The log file is flushed periodically rather than on each write
+    QTimer _launch_update_timer;                         // The captured output is displayed at a capped rate
+    QTimer _applications_sync_timer;                     // Polls the search of the applications executables
+    LayerWatcher _layer_watcher;                         // Keeps the layers in sync with the installed layers manifests
 
     void LoadConfigurationList();
+    void ActivateConfiguration(const std::string &configuration_name);
+    void ResetLayerWatcher(const std::vector<std::string> &previous_search_paths);
     void SetupLauncherTree();
 
     void closeEvent(QCloseEvent *event) override;
@@ -80,7 +92,14 @@ class MainWindow : public QMainWindow {
     std::unique_ptr<QDialog> vk_info_dialog;
     std::unique_ptr<QDialog> vk_installation_dialog;
 
+    // Owned by the main window, the last results of each probe are kept so that they are not queried again
+    std::array<VulkanProbe *, VULKAN_PROBE_COUNT> vulkan_probes;
+
+    VulkanProbe *StartVulkanProbe(VulkanProbeTask task);
+    void ReleaseVulkanProbe(VulkanProbeTask task);
+
     void Log(const std::string &log);
+    void LogOutput(const std::string &output);
 
     ConfigurationListItem *GetCheckedItem();
 
@@ -151,9 +170,15 @@ class MainWindow : public QMainWindow {
     void OnSettingsTreeClicked(QTreeWidgetItem *item, int column);
     void OnLauncherLoaderMessageChanged(int level);
 
-    void standardOutputAvailable();                                 // stdout output is available
-    void errorOutputAvailable();                                    // Layeroutput is available
-    void processClosed(int exitCode, QProcess::ExitStatus status);  // app died
+    void OnLaunchUpdate();    // Display the output captured since the last update
+    void OnLaunchFinished();  // app died
+
+    void OnLayersChanged();  // Layers manifests were added, updated or removed
+
+    void OnApplicationsSync();  // Remove the missing applications once their executables were searched
+
+    void OnVulkanProbeFinished();
+    void OnLogFileFlush();
 
    private:
     MainWindow(const MainWindow &) = delete;
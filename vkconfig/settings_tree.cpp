@@ -44,13 +44,25 @@
 #include <QRadioButton>
 #include <QApplication>
 #include <QSettings>
+#include <QScrollBar>
+#include <QEvent>
 
 #include <cassert>
 
 static const char *TOOLTIP_ORDER =
     "Layers are executed between the Vulkan application and driver in the specific order represented here";
 
-SettingsTreeManager::SettingsTreeManager() : tree(nullptr) {}
+static const int REFRESH_CONFIGURATION_DELAY_MS = 250;
+
+SettingsTreeManager::SettingsTreeManager() : tree(nullptr) {
+    this->refresh_configuration_timer.setSingleShot(true);
+    this->refresh_configuration_timer.setInterval(REFRESH_CONFIGURATION_DELAY_MS);
+    this->connect(&this->refresh_configuration_timer, SIGNAL(timeout()), this, SLOT(OnRefreshConfiguration()));
+
+    this->create_widgets_timer.setSingleShot(true);
+    this->create_widgets_timer.setInterval(0);
+    this->connect(&this->create_widgets_timer, SIGNAL(timeout()), this, SLOT(OnCreateVisibleWidgets()));
+}
 
 bool SettingsTreeManager::UseBuiltinValidationUI(Parameter &parameter) const {
     if (parameter.key != "VK_LAYER_KHRONOS_validation") {
@@ -115,8 +127,7 @@ void SettingsTreeManager::CreateGUI(QTreeWidget *build_tree) {
 
             if (parameter.state != LAYER_STATE_OVERRIDDEN) continue;
 
-            const std::vector<Layer> &available_layers = configurator.layers.available_layers;
-            const Layer *layer = FindByKey(available_layers, parameter.key.c_str());
+            const Layer *layer = configurator.layers.FindLayer(parameter.key);
 
             QTreeWidgetItem *layer_item = new QTreeWidgetItem();
             this->tree->addTopLevelItem(layer_item);
@@ -145,7 +156,7 @@ void SettingsTreeManager::CreateGUI(QTreeWidget *build_tree) {
                 continue;
             }
 
-            if (!layer->presets.empty()) {
+            if (!layer->GetPresets().empty()) {
                 QTreeWidgetItem *presets_item = new QTreeWidgetItem();
                 layer_item->addChild(presets_item);
                 WidgetPreset *presets_combobox = new WidgetPreset(this->tree, presets_item, *layer, parameter);
@@ -170,7 +181,7 @@ void SettingsTreeManager::CreateGUI(QTreeWidget *build_tree) {
         }
 
         const std::size_t excluded_layer_count =
-            CountExcludedLayers(configuration->parameters, configurator.layers.available_layers);
+            CountExcludedLayers(configuration->parameters, configurator.layers.GetLayers());
 
         if (excluded_layer_count > 0) {
             // The last item is just the excluded layers
@@ -188,7 +199,7 @@ void SettingsTreeManager::CreateGUI(QTreeWidget *build_tree) {
 
                 if (parameter.state != LAYER_STATE_EXCLUDED) continue;
 
-                const Layer *layer = FindByKey(configurator.layers.available_layers, parameter.key.c_str());
+                const Layer *layer = configurator.layers.FindLayer(parameter.key);
                 if (layer == nullptr) continue;  // Do not display missing excluded layers
 
                 QTreeWidgetItem *layer_item = new QTreeWidgetItem();
@@ -210,6 +221,12 @@ void SettingsTreeManager::CreateGUI(QTreeWidget *build_tree) {
     this->connect(this->tree, SIGNAL(expanded(const QModelIndex)), this, SLOT(OnExpandedChanged(const QModelIndex)));
     this->connect(this->tree, SIGNAL(collapsed(const QModelIndex)), this, SLOT(OnCollapsedChanged(const QModelIndex)));
 
+    this->connect(this->tree, SIGNAL(expanded(const QModelIndex)), this, SLOT(OnViewportChanged()), Qt::UniqueConnection);
+    this->connect(this->tree, SIGNAL(collapsed(const QModelIndex)), this, SLOT(OnViewportChanged()), Qt::UniqueConnection);
+    this->connect(this->tree->verticalScrollBar(), SIGNAL(valueChanged(int)), this, SLOT(OnViewportChanged()),
+                  Qt::UniqueConnection);
+    this->tree->viewport()->installEventFilter(this);
+
     this->tree->resizeColumnToContents(0);
 
     if (!configuration->setting_tree_state.isEmpty()) {
@@ -217,12 +234,22 @@ void SettingsTreeManager::CreateGUI(QTreeWidget *build_tree) {
     }
 
     this->tree->blockSignals(false);
+
+    // The widgets are created once the tree is laid out
+    this->create_widgets_timer.start();
 }
 
 void SettingsTreeManager::CleanupGUI() {
     if (this->tree == nullptr)  // Was not initialized
         return;
 
+    // Apply the pending setting edits before the tree and possibly the active configuration change
+    this->FlushRefreshConfiguration();
+
+    // The tree items are about to be deleted, even when there is no configuration to save the tree state to
+    this->create_widgets_timer.stop();
+    this->deferred_widgets.clear();
+
     Configurator &configurator = Configurator::Get();
 
     Configuration *configuration = configurator.configurations.GetActiveConfiguration();
@@ -233,6 +260,8 @@ void SettingsTreeManager::CleanupGUI() {
 
     this->validation.reset();
 
+    this->tree->viewport()->removeEventFilter(this);
+
     this->tree->clear();
     this->tree = nullptr;
 }
@@ -269,8 +298,7 @@ void SettingsTreeManager::OnCollapsedChanged(const QModelIndex &index) {
 
 void SettingsTreeManager::BuildValidationTree(QTreeWidgetItem *parent, Parameter &parameter) {
     Configurator &configurator = Configurator::Get();
-    std::vector<Layer> &available_layers = configurator.layers.available_layers;
-    Layer *validation_layer = FindByKey(available_layers, "VK_LAYER_KHRONOS_validation");
+    Layer *validation_layer = configurator.layers.FindLayer("VK_LAYER_KHRONOS_validation");
     assert(validation_layer != nullptr);
 
     QTreeWidgetItem *validation_areas_item = new QTreeWidgetItem();
@@ -324,50 +352,30 @@ void SettingsTreeManager::BuildTreeItem(QTreeWidgetItem *parent, Parameter &para
             item->setExpanded(meta_object.expanded);
         } break;
         case SETTING_BOOL:
-        case SETTING_BOOL_NUMERIC_DEPRECATED: {
-            const SettingMetaBool &meta = static_cast<const SettingMetaBool &>(meta_object);
-
-            WidgetSettingBool *widget = new WidgetSettingBool(tree, item, meta, parameter.settings);
-            this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
-        } break;
-
-        case SETTING_INT: {
-            const SettingMetaInt &meta = static_cast<const SettingMetaInt &>(meta_object);
-
-            WidgetSettingInt *widget = new WidgetSettingInt(tree, item, meta, parameter.settings);
-            this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
-        } break;
-
-        case SETTING_FLOAT: {
-            const SettingMetaFloat &meta = static_cast<const SettingMetaFloat &>(meta_object);
-
-            WidgetSettingFloat *widget = new WidgetSettingFloat(tree, item, meta, parameter.settings);
-            this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
-        } break;
-
-        case SETTING_FRAMES: {
-            const SettingMetaFrames &meta = static_cast<const SettingMetaFrames &>(meta_object);
-
-            WidgetSettingFrames *widget = new WidgetSettingFrames(tree, item, meta, parameter.settings);
-            this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
+        case SETTING_BOOL_NUMERIC_DEPRECATED:
+        case SETTING_INT:
+        case SETTING_FLOAT:
+        case SETTING_FRAMES:
+        case SETTING_STRING: {
+            this->DeferWidget(item, parameter, meta_object);
         } break;
 
         case SETTING_SAVE_FILE:
         case SETTING_LOAD_FILE:
         case SETTING_SAVE_FOLDER: {
-            const SettingMetaFilesystem &meta = static_cast<const SettingMetaFilesystem &>(meta_object);
+            // The child item of the path field is added upfront so that the tree state matches before and after the widget creation
+            QTreeWidgetItem *child = new QTreeWidgetItem();
+            child->setSizeHint(0, QSize(0, ITEM_HEIGHT));
+            item->addChild(child);
+            child->setExpanded(true);
 
-            WidgetSettingFilesystem *widget = new WidgetSettingFilesystem(tree, item, meta, parameter.settings);
-            this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
+            this->DeferWidget(item, parameter, meta_object);
         } break;
 
         case SETTING_ENUM: {
             const SettingMetaEnum &meta = static_cast<const SettingMetaEnum &>(meta_object);
 
-            WidgetSettingEnum *enum_widget = new WidgetSettingEnum(tree, item, meta, parameter.settings);
-            this->connect(enum_widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
-
-            SettingDataEnum *data = FindSetting<SettingDataEnum>(parameter.settings, meta.key.c_str());
+            this->DeferWidget(item, parameter, meta);
 
             for (std::size_t i = 0, n = meta.enum_values.size(); i < n; ++i) {
                 const SettingEnumValue &value = meta.enum_values[i];
@@ -397,8 +405,7 @@ void SettingsTreeManager::BuildTreeItem(QTreeWidgetItem *parent, Parameter &para
                 QTreeWidgetItem *child = new QTreeWidgetItem();
                 item->addChild(child);
 
-                WidgetSettingFlag *widget = new WidgetSettingFlag(tree, child, meta, parameter.settings, value.key.c_str());
-                this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
+                this->DeferWidget(child, parameter, meta, &value);
 
                 for (std::size_t j = 0, o = value.settings.size(); j < o; ++j) {
                     this->BuildTreeItem(child, parameter, *value.settings[j]);
@@ -406,18 +413,20 @@ void SettingsTreeManager::BuildTreeItem(QTreeWidgetItem *parent, Parameter &para
             }
         } break;
 
-        case SETTING_STRING: {
-            const SettingMetaString &meta = static_cast<const SettingMetaString &>(meta_object);
-
-            WidgetSettingString *widget = new WidgetSettingString(tree, item, meta, parameter.settings);
-            this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
-        } break;
-
         case SETTING_LIST: {
             const SettingMetaList &meta = static_cast<const SettingMetaList &>(meta_object);
 
-            WidgetSettingList *widget = new WidgetSettingList(tree, item, meta, parameter.settings);
-            this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
+            // One child item per list element, replaced by the element widgets when the list widget is created
+            const SettingDataList *data = FindSetting<SettingDataList>(parameter.settings, meta.key.c_str());
+            assert(data != nullptr);
+
+            for (std::size_t i = 0, n = data->value.size(); i < n; ++i) {
+                QTreeWidgetItem *child = new QTreeWidgetItem();
+                child->setSizeHint(0, QSize(0, ITEM_HEIGHT));
+                item->addChild(child);
+            }
+
+            this->DeferWidget(item, parameter, meta);
         } break;
 
         default: {
@@ -432,9 +441,7 @@ void SettingsTreeManager::BuildTreeItem(QTreeWidgetItem *parent, Parameter &para
 }
 
 void SettingsTreeManager::BuildGenericTree(QTreeWidgetItem *parent, Parameter &parameter) {
-    std::vector<Layer> &available_layers = Configurator::Get().layers.available_layers;
-
-    const SettingMetaSet &settings = FindByKey(available_layers, parameter.key.c_str())->settings;
+    const SettingMetaSet &settings = Configurator::Get().layers.FindLayer(parameter.key)->settings;
     for (std::size_t i = 0, n = settings.size(); i < n; ++i) {
         this->BuildTreeItem(parent, parameter, *settings[i]);
     }
@@ -480,6 +487,9 @@ void SettingsTreeManager::Refresh(RefreshAreas refresh_areas) {
 
     this->tree->blockSignals(false);
 
+    // Settings dependences may have shown rows without widgets yet
+    this->create_widgets_timer.start();
+
     QSettings settings;
     if (!settings.value("vkconfig_restart", false).toBool()) {
         settings.setValue("vkconfig_restart", true);
@@ -487,9 +497,20 @@ void SettingsTreeManager::Refresh(RefreshAreas refresh_areas) {
         Alert::ConfiguratorRestart();
     }
 
-    // Refresh layer configuration
+    // Refresh layer configuration, restarting the timer to batch rapid edits
+    this->refresh_configuration_timer.start();
+}
+
+void SettingsTreeManager::OnRefreshConfiguration() {
     Configurator &configurator = Configurator::Get();
-    configurator.configurations.RefreshConfiguration(configurator.layers.available_layers);
+    configurator.configurations.RefreshConfiguration(configurator.layers.GetLayers());
+}
+
+void SettingsTreeManager::FlushRefreshConfiguration() {
+    if (!this->refresh_configuration_timer.isActive()) return;
+
+    this->refresh_configuration_timer.stop();
+    this->OnRefreshConfiguration();
 }
 
 void SettingsTreeManager::RefreshItem(RefreshAreas refresh_areas, QTreeWidgetItem *parent) {
@@ -497,6 +518,9 @@ void SettingsTreeManager::RefreshItem(RefreshAreas refresh_areas, QTreeWidgetIte
     if (widget != nullptr) {
         WidgetSettingBase *widget_base = dynamic_cast<WidgetSettingBase *>(widget);
         if (widget_base != nullptr) widget_base->Refresh(refresh_areas);
+    } else {
+        auto it = this->deferred_widgets.find(parent);
+        if (it != this->deferred_widgets.end()) this->RefreshDeferredItem(parent, it->second);
     }
 
     for (int i = 0, n = parent->childCount(); i < n; ++i) {
@@ -506,3 +530,117 @@ void SettingsTreeManager::RefreshItem(RefreshAreas refresh_areas, QTreeWidgetIte
         this->RefreshItem(refresh_areas, child);
     }
 }
+
+void SettingsTreeManager::DeferWidget(QTreeWidgetItem *item, Parameter &parameter, const SettingMeta &meta,
+                                      const SettingEnumValue *flag) {
+    DeferredWidget deferred;
+    deferred.parameter = &parameter;
+    deferred.meta = &meta;
+    if (flag != nullptr) deferred.flag = flag->key;
+
+    item->setSizeHint(0, QSize(0, ITEM_HEIGHT));
+    item->setExpanded(flag != nullptr ? flag->expanded : meta.expanded);  // A flag item has the expanded state of its value
+    this->RefreshDeferredItem(item, deferred);
+
+    this->deferred_widgets[item] = deferred;
+}
+
+void SettingsTreeManager::CreateWidget(QTreeWidgetItem *item, const DeferredWidget &deferred) {
+    SettingDataSet &data_set = deferred.parameter->settings;
+
+    WidgetSettingBase *widget = nullptr;
+
+    switch (deferred.meta->type) {
+        case SETTING_BOOL:
+        case SETTING_BOOL_NUMERIC_DEPRECATED: {
+            const SettingMetaBool &meta = static_cast<const SettingMetaBool &>(*deferred.meta);
+            widget = new WidgetSettingBool(this->tree, item, meta, data_set);
+        } break;
+        case SETTING_INT: {
+            const SettingMetaInt &meta = static_cast<const SettingMetaInt &>(*deferred.meta);
+            widget = new WidgetSettingInt(this->tree, item, meta, data_set);
+        } break;
+        case SETTING_FLOAT: {
+            const SettingMetaFloat &meta = static_cast<const SettingMetaFloat &>(*deferred.meta);
+            widget = new WidgetSettingFloat(this->tree, item, meta, data_set);
+        } break;
+        case SETTING_FRAMES: {
+            const SettingMetaFrames &meta = static_cast<const SettingMetaFrames &>(*deferred.meta);
+            widget = new WidgetSettingFrames(this->tree, item, meta, data_set);
+        } break;
+        case SETTING_STRING: {
+            const SettingMetaString &meta = static_cast<const SettingMetaString &>(*deferred.meta);
+            widget = new WidgetSettingString(this->tree, item, meta, data_set);
+        } break;
+        case SETTING_ENUM: {
+            const SettingMetaEnum &meta = static_cast<const SettingMetaEnum &>(*deferred.meta);
+            widget = new WidgetSettingEnum(this->tree, item, meta, data_set);
+        } break;
+        case SETTING_FLAGS: {
+            const SettingMetaFlags &meta = static_cast<const SettingMetaFlags &>(*deferred.meta);
+            widget = new WidgetSettingFlag(this->tree, item, meta, data_set, deferred.flag);
+        } break;
+        case SETTING_SAVE_FILE:
+        case SETTING_LOAD_FILE:
+        case SETTING_SAVE_FOLDER: {
+            const SettingMetaFilesystem &meta = static_cast<const SettingMetaFilesystem &>(*deferred.meta);
+            widget = new WidgetSettingFilesystem(this->tree, item, meta, data_set);
+        } break;
+        case SETTING_LIST: {
+            const SettingMetaList &meta = static_cast<const SettingMetaList &>(*deferred.meta);
+            widget = new WidgetSettingList(this->tree, item, meta, data_set);
+        } break;
+        default: {
+            assert(0);  // Unknown setting
+        } break;
+    }
+
+    if (widget != nullptr) {
+        this->connect(widget, SIGNAL(itemChanged()), this, SLOT(OnSettingChanged()));
+    }
+}
+
+// Without a widget to refresh itself, only the item visibility needs to follow the setting dependences
+void SettingsTreeManager::RefreshDeferredItem(QTreeWidgetItem *item, const DeferredWidget &deferred) {
+    const SettingDependenceMode enabled = ::CheckDependence(*deferred.meta, deferred.parameter->settings);
+
+    item->setHidden(enabled == SETTING_DEPENDENCE_HIDE);
+    item->setDisabled(enabled != SETTING_DEPENDENCE_ENABLE);
+}
+
+void SettingsTreeManager::OnViewportChanged() { this->create_widgets_timer.start(); }
+
+void SettingsTreeManager::OnCreateVisibleWidgets() {
+    if (this->tree == nullptr) return;
+    if (this->deferred_widgets.empty()) return;
+
+    const int viewport_height = this->tree->viewport()->height();
+
+    this->tree->blockSignals(true);
+
+    QTreeWidgetItem *item = this->tree->itemAt(0, 0);
+    while (item != nullptr && this->tree->visualItemRect(item).top() < viewport_height) {
+        auto it = this->deferred_widgets.find(item);
+        if (it != this->deferred_widgets.end()) {
+            // The widgets reset the expanded state that was restored from the configuration
+            const bool expanded = item->isExpanded();
+            this->CreateWidget(item, it->second);
+            item->setExpanded(expanded);
+
+            this->deferred_widgets.erase(it);
+        }
+
+        // Only once the widget is created: the list widget replaces the child items of its elements
+        item = this->tree->itemBelow(item);
+    }
+
+    this->tree->blockSignals(false);
+}
+
+bool SettingsTreeManager::eventFilter(QObject *target, QEvent *event) {
+    if (this->tree != nullptr && target == this->tree->viewport() && event->type() == QEvent::Resize) {
+        this->create_widgets_timer.start();
+    }
+
+    return QObject::eventFilter(target, event);
+}
@@ -30,9 +30,12 @@
 
 #include <QObject>
 #include <QTreeWidget>
+#include <QTimer>
 
 #include <vector>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 class SettingsTreeManager : QObject {
     Q_OBJECT
@@ -47,11 +50,17 @@ class SettingsTreeManager : QObject {
 
     void Refresh(RefreshAreas refresh_areas);
 
+    // Apply immediately the setting edits still waiting to be written in the override files
+    void FlushRefreshConfiguration();
+
    public Q_SLOTS:
     void OnSettingChanged();
     void OnPresetChanged();
     void OnExpandedChanged(const QModelIndex &index);
     void OnCollapsedChanged(const QModelIndex &index);
+    void OnRefreshConfiguration();
+    void OnViewportChanged();
+    void OnCreateVisibleWidgets();
 
    private:
     SettingsTreeManager(const SettingsTreeManager &) = delete;
@@ -65,6 +74,23 @@ class SettingsTreeManager : QObject {
 
     void RefreshItem(RefreshAreas refresh_areas, QTreeWidgetItem *parent);
 
+    bool eventFilter(QObject *target, QEvent *event) override;
+
+    // The setting widgets are only created when their tree item is scrolled into view. The pointers are only valid until the
+    // layers or the configurations are reloaded, CleanupGUI must be called before.
+    struct DeferredWidget {
+        Parameter *parameter;
+        const SettingMeta *meta;
+        std::string flag;  // Only used by SETTING_FLAGS values
+    };
+
+    void DeferWidget(QTreeWidgetItem *item, Parameter &parameter, const SettingMeta &meta, const SettingEnumValue *flag = nullptr);
+    void CreateWidget(QTreeWidgetItem *item, const DeferredWidget &deferred);
+    void RefreshDeferredItem(QTreeWidgetItem *item, const DeferredWidget &deferred);
+
     QTreeWidget *tree;
     std::unique_ptr<WidgetSettingValidation> validation;
+    QTimer refresh_configuration_timer;  // Batch rapid setting edits into a single override files update
+    QTimer create_widgets_timer;         // Batch scrolling, resizing and expanding into a single widgets creation
+    std::unordered_map<QTreeWidgetItem *, DeferredWidget> deferred_widgets;
 };
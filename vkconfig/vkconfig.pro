@@ -31,6 +31,7 @@ SOURCES += \
     ../vkconfig_core/alert.cpp \
     ../vkconfig_core/application.cpp \
     ../vkconfig_core/application_singleton.cpp \
+    ../vkconfig_core/builtin.cpp \
     ../vkconfig_core/command_line.cpp \
     ../vkconfig_core/configuration.cpp \
     ../vkconfig_core/configuration_manager.cpp \
@@ -43,6 +44,7 @@ SOURCES += \
     ../vkconfig_core/json_validator.cpp \
     ../vkconfig_core/layer.cpp \
     ../vkconfig_core/layer_manager.cpp \
+    ../vkconfig_core/layer_watcher.cpp \
     ../vkconfig_core/layer_preset.cpp \
     ../vkconfig_core/layer_state.cpp \
     ../vkconfig_core/layer_type.cpp \
@@ -64,6 +66,8 @@ SOURCES += \
     ../vkconfig_core/setting_string.cpp \
     ../vkconfig_core/util.cpp \
     ../vkconfig_core/version.cpp \
+    vulkan_probe.cpp \
+    launch_capture.cpp \
     vulkan_util.cpp \
     widget_preset.cpp \
     widget_setting.cpp \
@@ -89,6 +93,9 @@ SOURCES += \
     main_reset.cpp \
     main_layers.cpp \
     main_doc.cpp \
+    main_daemon.cpp \
+    layers_batch.cpp \
+    layers_daemon.cpp \
     mainwindow.cpp \
     settings_tree.cpp \
     settings_validation_areas.cpp \
@@ -98,6 +105,7 @@ HEADERS += \
     ../vkconfig_core/alert.h \
     ../vkconfig_core/application.h \
     ../vkconfig_core/application_singleton.h \
+    ../vkconfig_core/builtin.h \
     ../vkconfig_core/command_line.h \
     ../vkconfig_core/configuration.h \
     ../vkconfig_core/configuration_manager.h \
@@ -110,6 +118,7 @@ HEADERS += \
     ../vkconfig_core/json_validator.h \
     ../vkconfig_core/layer.h \
     ../vkconfig_core/layer_manager.h \
+    ../vkconfig_core/layer_watcher.h \
     ../vkconfig_core/layer_preset.h \
     ../vkconfig_core/layer_state.h \
     ../vkconfig_core/layer_type.h \
@@ -131,6 +140,8 @@ HEADERS += \
     ../vkconfig_core/setting_string.h \
     ../vkconfig_core/util.h \
     ../vkconfig_core/version.h \
+    vulkan_probe.h \
+    launch_capture.h \
     vulkan_util.h \
     widget_preset.h \
     widget_setting.h \
@@ -155,6 +166,9 @@ HEADERS += \
     main_reset.h \
     main_layers.h \
     main_doc.h \
+    main_daemon.h \
+    layers_batch.h \
+    layers_daemon.h \
     mainwindow.h \
     settings_validation_areas.h \
     settings_tree.h \
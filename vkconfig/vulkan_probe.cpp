@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "vulkan_probe.h"
+#include "vulkan_util.h"
+
+#include "../vkconfig_core/util.h"
+#include "../vkconfig_core/platform.h"
+#include "../vkconfig_core/override.h"
+
+#include <vulkan/vulkan.h>
+
+#include <QLibrary>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QFile>
+#include <QDir>
+#include <QJsonParseError>
+
+#include <cstdio>
+#include <cassert>
+
+static const char *GetPhysicalDeviceType(VkPhysicalDeviceType type) {
+    const char *translation[] = {"Other", "Integrated GPU", "Discrete GPU", "Virtual GPU", "CPU"};
+    return translation[type];
+}
+
+static VkResult CreateInstance(QLibrary &library, VkInstance &instance, bool enumerate_portability) {
+    if (!enumerate_portability) return VK_ERROR_INCOMPATIBLE_DRIVER;
+
+    PFN_vkEnumerateInstanceExtensionProperties vkEnumerateInstanceExtensionProperties =
+        (PFN_vkEnumerateInstanceExtensionProperties)library.resolve("vkEnumerateInstanceExtensionProperties");
+    assert(vkEnumerateInstanceExtensionProperties);
+
+    uint32_t property_count = 0;
+    VkResult err = vkEnumerateInstanceExtensionProperties(nullptr, &property_count, nullptr);
+    assert(err == VK_SUCCESS);
+
+    std::vector<VkExtensionProperties> instance_properties(property_count);
+    err = vkEnumerateInstanceExtensionProperties(nullptr, &property_count, &instance_properties[0]);
+    assert(err == VK_SUCCESS);
+
+    // Handle Portability Enumeration requirements
+    std::vector<const char *> instance_extensions;
+#if VK_KHR_portability_enumeration
+    for (std::size_t i = 0, n = instance_properties.size(); i < n && enumerate_portability; ++i) {
+        if (instance_properties[i].extensionName == std::string(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)) {
+            instance_extensions.push_back(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME);
+            break;
+        }
+    }
+#endif
+
+    // Check Vulkan Devices
+
+    VkApplicationInfo app = {};
+    app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app.pNext = nullptr;
+    app.pApplicationName = VKCONFIG_SHORT_NAME;
+    app.applicationVersion = 0;
+    app.pEngineName = VKCONFIG_SHORT_NAME;
+    app.engineVersion = 0;
+    app.apiVersion = VK_API_VERSION_1_0;
+
+    VkInstanceCreateInfo inst_info = {};
+    inst_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+#if VK_KHR_portability_enumeration
+    if (!instance_extensions.empty()) {
+        inst_info.flags = VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR;
+    }
+#endif
+    inst_info.pNext = nullptr;
+    inst_info.pApplicationInfo = &app;
+    inst_info.enabledLayerCount = 0;
+    inst_info.ppEnabledLayerNames = nullptr;
+    inst_info.enabledExtensionCount = static_cast<uint32_t>(instance_extensions.size());
+    inst_info.ppEnabledExtensionNames = instance_extensions.empty() ? nullptr : &instance_extensions[0];
+
+    PFN_vkCreateInstance vkCreateInstance = (PFN_vkCreateInstance)library.resolve("vkCreateInstance");
+    assert(vkCreateInstance);
+
+    return vkCreateInstance(&inst_info, nullptr, &instance);
+}
+
+VulkanProbe::VulkanProbe(VulkanProbeTask task, QObject *parent) : QThread(parent), task(task), result(VULKAN_PROBE_CANCELED) {}
+
+VulkanProbe::~VulkanProbe() {
+    this->requestInterruption();
+    this->wait();
+}
+
+int VulkanProbe::GetStepCount() const {
+    static const int TABLE[] = {
+        4,  // VULKAN_PROBE_STATUS
+        3,  // VULKAN_PROBE_INFO
+        3,  // VULKAN_PROBE_ANALYSIS
+    };
+    static_assert(countof(TABLE) == VULKAN_PROBE_COUNT, "The tranlation table size doesn't match the enum number of elements");
+
+    return TABLE[this->task];
+}
+
+void VulkanProbe::run() {
+    switch (this->task) {
+        case VULKAN_PROBE_STATUS: {
+            this->result = this->ProbeSystem();
+            break;
+        }
+        case VULKAN_PROBE_INFO: {
+            static const char *VULKAN_INFO_PATH[] = {
+                "vulkaninfoSDK",              // PLATFORM_WINDOWS
+                "vulkaninfo",                 // PLATFORM_LINUX
+                "/usr/local/bin/vulkaninfo",  // PLATFORM_MACOS
+                "N/A",                        // PLATFORM_ANDROID
+            };
+            static_assert(countof(VULKAN_INFO_PATH) == PLATFORM_COUNT,
+                          "The tranlation table size doesn't match the enum number of elements");
+
+            QStringList args;
+            args << "--vkconfig_output";
+            args << QDir::temp().path();
+
+            this->result = this->ProbeTool(VULKAN_INFO_PATH[VKC_PLATFORM], args, QDir::temp().path() + "/vulkaninfo.json");
+            break;
+        }
+        case VULKAN_PROBE_ANALYSIS: {
+#if VKC_PLATFORM == VKC_PLATFORM_MACOS
+            const QString program("/usr/local/bin/vkvia");
+#else
+            const QString program("vkvia");
+#endif
+
+            QStringList args;
+            args << "--output_path" << QDir::temp().path();
+            args << "--vkconfig_output";
+            args << "--disable_cube_tests";
+
+            this->result = this->ProbeTool(program, args, QDir::temp().path() + "/vkvia.json");
+            break;
+        }
+        default: {
+            assert(0);
+            break;
+        }
+    }
+}
+
+// The layers override is disabled by the environment of Vulkan Configurator, see run_gui
+VulkanProbeResult VulkanProbe::ProbeSystem() {
+    QLibrary library(GetVulkanLibrary());
+    if (!library.load()) return VULKAN_PROBE_LOADER_FAILURE;
+
+    this->system.loader_version = GetVulkanLoaderVersion();
+    if (this->system.loader_version == Version::VERSION_NULL) return VULKAN_PROBE_LOADER_FAILURE;
+
+    emit ProgressChanged(1);
+    if (this->isInterruptionRequested()) return VULKAN_PROBE_CANCELED;
+
+    PFN_vkEnumerateInstanceLayerProperties vkEnumerateInstanceLayerProperties =
+        (PFN_vkEnumerateInstanceLayerProperties)library.resolve("vkEnumerateInstanceLayerProperties");
+    assert(vkEnumerateInstanceLayerProperties);
+
+    std::uint32_t instance_layer_count = 0;
+    VkResult err = vkEnumerateInstanceLayerProperties(&instance_layer_count, NULL);
+    assert(!err);
+
+    std::vector<VkLayerProperties> layers_properties;
+    layers_properties.resize(instance_layer_count);
+
+    err = vkEnumerateInstanceLayerProperties(&instance_layer_count, &layers_properties[0]);
+    assert(!err);
+
+    for (std::size_t i = 0, n = layers_properties.size(); i < n; ++i) {
+        this->system.layers.push_back(layers_properties[i].layerName);
+    }
+
+    emit ProgressChanged(2);
+    if (this->isInterruptionRequested()) return VULKAN_PROBE_CANCELED;
+
+    VkInstance inst = VK_NULL_HANDLE;
+    err = CreateInstance(library, inst, false);
+    if (err == VK_ERROR_INCOMPATIBLE_DRIVER) {
+        // If no compatible driver were found, trying with portability enumeration
+        err = CreateInstance(library, inst, true);
+        if (err == VK_ERROR_INCOMPATIBLE_DRIVER) {
+            return VULKAN_PROBE_INSTANCE_FAILURE;
+        }
+    }
+    assert(err == VK_SUCCESS);
+
+    PFN_vkDestroyInstance vkDestroyInstance = (PFN_vkDestroyInstance)library.resolve("vkDestroyInstance");
+
+    emit ProgressChanged(3);
+    if (this->isInterruptionRequested()) {
+        vkDestroyInstance(inst, NULL);
+        return VULKAN_PROBE_CANCELED;
+    }
+
+    PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices =
+        (PFN_vkEnumeratePhysicalDevices)library.resolve("vkEnumeratePhysicalDevices");
+
+    uint32_t gpu_count = 0;
+    err = vkEnumeratePhysicalDevices(inst, &gpu_count, NULL);
+
+    // This can fail on a new Linux setup. Check and fail gracefully rather than crash.
+    if (err != VK_SUCCESS) {
+        vkDestroyInstance(inst, NULL);
+        return VULKAN_PROBE_PHYSICAL_DEVICE_FAILURE;
+    }
+
+    std::vector<VkPhysicalDevice> devices;
+    devices.resize(gpu_count);
+
+    err = vkEnumeratePhysicalDevices(inst, &gpu_count, &devices[0]);
+    assert(!err);
+
+    PFN_vkGetPhysicalDeviceProperties vkGetPhysicalDeviceProperties =
+        (PFN_vkGetPhysicalDeviceProperties)library.resolve("vkGetPhysicalDeviceProperties");
+
+    for (std::size_t i = 0, n = devices.size(); i < n; ++i) {
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(devices[i], &properties);
+        this->system.physical_devices.push_back(format("%s (%s) with Vulkan %d.%d.%d", properties.deviceName,
+                                                       GetPhysicalDeviceType(properties.deviceType),
+                                                       VK_VERSION_MAJOR(properties.apiVersion),
+                                                       VK_VERSION_MINOR(properties.apiVersion),
+                                                       VK_VERSION_PATCH(properties.apiVersion)));
+    }
+
+    vkDestroyInstance(inst, NULL);
+
+    emit ProgressChanged(4);
+
+    return VULKAN_PROBE_SUCCESS;
+}
+
+VulkanProbeResult VulkanProbe::ProbeTool(const QString &program, const QStringList &arguments, const QString &output_path) {
+    // Wait... make sure we don't pick up the old one!
+    remove(output_path.toUtf8().constData());
+
+    // The overridden layers would be reported as part of the Vulkan installation
+    QProcessEnvironment process_environment = QProcessEnvironment::systemEnvironment();
+    process_environment.insert(GetDisableOverrideVariable(), "1");
+
+    QProcess process;
+    process.setProcessEnvironment(process_environment);
+    process.setProgram(program);
+    process.setArguments(arguments);
+    process.start();
+    if (!process.waitForStarted()) return VULKAN_PROBE_TOOL_FAILURE;
+
+    emit ProgressChanged(1);
+
+    // Poll the process so that it can be killed when the probe is canceled
+    while (!process.waitForFinished(100)) {
+        if (process.state() == QProcess::NotRunning) break;
+
+        if (this->isInterruptionRequested()) {
+            process.kill();
+            process.waitForFinished();
+            return VULKAN_PROBE_CANCELED;
+        }
+    }
+
+    emit ProgressChanged(2);
+
+    QFile file(output_path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return VULKAN_PROBE_TOOL_FAILURE;
+    }
+
+    const QByteArray json_text = file.readAll();
+    file.close();
+
+    QJsonParseError parse_error;
+    this->document = QJsonDocument::fromJson(json_text, &parse_error);
+    if (parse_error.error != QJsonParseError::NoError) {
+        this->error = parse_error.errorString();
+        return VULKAN_PROBE_PARSE_FAILURE;
+    }
+
+    if (this->document.isNull() || this->document.isEmpty()) {
+        this->error = "Json document is empty!";
+        return VULKAN_PROBE_PARSE_FAILURE;
+    }
+
+    emit ProgressChanged(3);
+
+    return VULKAN_PROBE_SUCCESS;
+}
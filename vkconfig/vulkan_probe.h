@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#pragma once
+
+#include "../vkconfig_core/version.h"
+
+#include <QThread>
+#include <QString>
+#include <QStringList>
+#include <QJsonDocument>
+
+#include <string>
+#include <vector>
+
+enum VulkanProbeTask {
+    VULKAN_PROBE_STATUS = 0,  // Loader, layers and physical devices found with the Vulkan API
+    VULKAN_PROBE_INFO,        // vulkaninfo output
+    VULKAN_PROBE_ANALYSIS,    // vkvia output
+
+    VULKAN_PROBE_FIRST = VULKAN_PROBE_STATUS,
+    VULKAN_PROBE_LAST = VULKAN_PROBE_ANALYSIS,
+};
+
+enum { VULKAN_PROBE_COUNT = VULKAN_PROBE_LAST - VULKAN_PROBE_FIRST + 1 };
+
+enum VulkanProbeResult {
+    VULKAN_PROBE_SUCCESS = 0,
+    VULKAN_PROBE_CANCELED,
+    VULKAN_PROBE_LOADER_FAILURE,
+    VULKAN_PROBE_INSTANCE_FAILURE,
+    VULKAN_PROBE_PHYSICAL_DEVICE_FAILURE,
+    VULKAN_PROBE_TOOL_FAILURE,  // The tool didn't run or didn't write its output
+    VULKAN_PROBE_PARSE_FAILURE
+};
+
+struct VulkanSystem {
+    Version loader_version;
+    std::vector<std::string> layers;            // Instance layers names
+    std::vector<std::string> physical_devices;  // Physical devices descriptions
+};
+
+// Query the Vulkan installation on a worker thread so that a slow Vulkan driver doesn't block the user interface. The results
+// remain available once the thread finished so that they are reused instead of querying the Vulkan installation again.
+class VulkanProbe : public QThread {
+    Q_OBJECT
+
+   public:
+    explicit VulkanProbe(VulkanProbeTask task, QObject* parent = nullptr);
+    ~VulkanProbe();
+
+    VulkanProbeTask GetTask() const { return this->task; }
+    int GetStepCount() const;
+
+    // The results are only valid once the thread finished
+    VulkanProbeResult GetResult() const { return this->result; }
+    const VulkanSystem& GetSystem() const { return this->system; }
+    const QJsonDocument& GetDocument() const { return this->document; }
+    const QString& GetError() const { return this->error; }
+
+   signals:
+    void ProgressChanged(int step);
+
+   protected:
+    void run() override;
+
+   private:
+    VulkanProbe(const VulkanProbe&) = delete;
+    VulkanProbe& operator=(const VulkanProbe&) = delete;
+
+    VulkanProbeResult ProbeSystem();
+    VulkanProbeResult ProbeTool(const QString& program, const QStringList& arguments, const QString& output_path);
+
+    const VulkanProbeTask task;
+    VulkanProbeResult result;
+    VulkanSystem system;
+    QJsonDocument document;
+    QString error;
+};
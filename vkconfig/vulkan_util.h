@@ -22,7 +22,12 @@
 
 #include "../vkconfig_core/version.h"
 
+#include "vulkan_probe.h"
+
 #include <string>
 
+const char* GetVulkanLibrary();
 Version GetVulkanLoaderVersion();
-std::string GenerateVulkanStatus();
+
+// Format the result of a finished VULKAN_PROBE_STATUS probe
+std::string GenerateVulkanStatus(const VulkanProbe& probe);
@@ -32,8 +32,8 @@ WidgetPreset::WidgetPreset(QTreeWidget* tree, QTreeWidgetItem* item, const Layer
 
     preset_labels.push_back(Layer::NO_PRESET);
 
-    for (std::size_t i = 0, n = layer.presets.size(); i < n; ++i) {
-        const LayerPreset& layer_preset = layer.presets[i];
+    for (std::size_t i = 0, n = layer.GetPresets().size(); i < n; ++i) {
+        const LayerPreset& layer_preset = layer.GetPresets()[i];
 
         if (!IsPlatformSupported(layer_preset.platform_flags)) continue;
         if (layer_preset.view == SETTING_VIEW_HIDDEN) continue;
@@ -60,7 +60,7 @@ void WidgetPreset::Refresh(RefreshAreas refresh_areas) {
     this->field->blockSignals(false);
 
     if (preset_label != Layer::NO_PRESET) {
-        const LayerPreset* preset = GetPreset(layer.presets, preset_label.c_str());
+        const LayerPreset* preset = GetPreset(layer.GetPresets(), preset_label.c_str());
         assert(preset != nullptr);
         this->setToolTip(preset->description.c_str());
     }
@@ -86,7 +86,7 @@ void WidgetPreset::OnPresetChanged(int combox_preset_index) {
 
     if (preset_label == Layer::NO_PRESET) return;
 
-    const LayerPreset* preset = GetPreset(layer.presets, preset_label.c_str());
+    const LayerPreset* preset = GetPreset(layer.GetPresets(), preset_label.c_str());
     assert(preset != nullptr);
     parameter.ApplyPresetSettings(*preset);
 
@@ -35,7 +35,7 @@ WidgetSettingFilesystem::WidgetSettingFilesystem(QTreeWidget* tree, QTreeWidgetI
     : WidgetSettingBase(tree, item),
       meta(meta),
       data_set(data_set),
-      item_child(new QTreeWidgetItem()),
+      item_child(item->childCount() > 0 ? item->child(0) : new QTreeWidgetItem()),
       field(new QLineEdit(this)),
       button(new QPushButton(this)) {
     assert(&meta);
@@ -51,7 +51,9 @@ WidgetSettingFilesystem::WidgetSettingFilesystem(QTreeWidget* tree, QTreeWidgetI
     this->item->setToolTip(0, meta.description.c_str());
     this->item->setSizeHint(0, QSize(0, ITEM_HEIGHT));
     this->item->setExpanded(this->meta.expanded);
-    this->item->addChild(item_child);
+    if (this->item_child->parent() == nullptr) {  // The settings tree adds the child item when the widget creation is deferred
+        this->item->addChild(item_child);
+    }
     tree->setItemWidget(this->item, 0, this);
 
     this->item_child->setSizeHint(0, QSize(0, ITEM_HEIGHT));
@@ -27,8 +27,55 @@
 
 #include <QMessageBox>
 
+#include <algorithm>
 #include <cassert>
 
+SettingListModel::SettingListModel(const SettingMetaList &meta, const std::vector<EnabledNumberOrString> &value, QObject *parent)
+    : QAbstractListModel(parent), meta(meta), selected(meta.list.size(), false) {
+    for (std::size_t i = 0, n = value.size(); i < n; ++i) {
+        const int index = this->meta.FindValueIndex(value[i]);
+        if (index != -1) this->selected[index] = true;
+    }
+
+    this->rows.reserve(this->meta.list.size());
+    for (std::size_t i = 0, n = this->selected.size(); i < n; ++i) {
+        if (!this->selected[i]) this->rows.push_back(static_cast<int>(i));
+    }
+}
+
+void SettingListModel::Select(const NumberOrString &value, bool selected) {
+    const int index = this->meta.FindValueIndex(value);
+    if (index == -1) return;  // Value added by the user, not listed by the layer
+    if (this->selected[index] == selected) return;
+
+    this->selected[index] = selected;
+
+    const auto it = std::lower_bound(this->rows.begin(), this->rows.end(), index);
+    const int row = static_cast<int>(std::distance(this->rows.begin(), it));
+
+    if (selected) {
+        this->beginRemoveRows(QModelIndex(), row, row);
+        this->rows.erase(it);
+        this->endRemoveRows();
+    } else {
+        this->beginInsertRows(QModelIndex(), row, row);
+        this->rows.insert(it, index);
+        this->endInsertRows();
+    }
+}
+
+int SettingListModel::rowCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(this->rows.size());
+}
+
+QVariant SettingListModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid() || index.row() >= static_cast<int>(this->rows.size())) return QVariant();
+    if (role != Qt::DisplayRole && role != Qt::EditRole) return QVariant();
+
+    const NumberOrString &value = this->meta.list[this->rows[index.row()]];
+    return value.key.empty() ? QString::number(value.number) : QString(value.key.c_str());
+}
+
 const char *GetFieldToolTip(const SettingMetaList &meta, bool current_list_empty) {
     if (meta.list.empty()) {
         return "Start tapping to add a new value";
@@ -44,18 +91,16 @@ WidgetSettingList::WidgetSettingList(QTreeWidget *tree, QTreeWidgetItem *item, c
     : WidgetSettingBase(tree, item),
       meta(meta),
       data_set(data_set),
+      model(nullptr),
       search(nullptr),
       field(new QLineEdit(this)),
-      add_button(new QPushButton(this)),
-      list(meta.list) {
+      add_button(new QPushButton(this)) {
     assert(&this->meta);
 
     std::vector<EnabledNumberOrString> value = this->data().value;
-    for (std::size_t i = 0, n = value.size(); i < n; ++i) {
-        ::RemoveValue(this->list, value[i]);
-    }
+    this->model = new SettingListModel(this->meta, value, this);
 
-    const char *tooltip = GetFieldToolTip(this->meta, this->list.empty());
+    const char *tooltip = GetFieldToolTip(this->meta, this->model->rowCount() == 0);
 
     this->field->show();
     this->field->setText("");
@@ -63,7 +108,16 @@ WidgetSettingList::WidgetSettingList(QTreeWidget *tree, QTreeWidgetItem *item, c
     this->field->setFont(this->tree->font());
     this->field->setFocusPolicy(Qt::StrongFocus);
     this->field->installEventFilter(this);
-    this->ResetCompleter();
+
+    this->search = new QCompleter(this->model, this);
+    this->search->setCompletionMode(QCompleter::PopupCompletion);
+    this->search->setModelSorting(QCompleter::CaseSensitivelySortedModel);
+    this->search->setFilterMode(Qt::MatchContains);
+    this->search->setCaseSensitivity(Qt::CaseSensitive);
+    this->search->setMaxVisibleItems(20);
+    this->field->setCompleter(this->search);
+
+    this->connect(this->search, SIGNAL(activated(const QString &)), this, SLOT(OnCompleted(const QString &)), Qt::QueuedConnection);
 
     this->connect(this->field, SIGNAL(textChanged(const QString &)), this, SLOT(OnTextEdited(const QString &)));
     this->connect(this->field, SIGNAL(returnPressed()), this, SLOT(OnElementAppended()), Qt::QueuedConnection);
@@ -93,10 +147,12 @@ void WidgetSettingList::Refresh(RefreshAreas refresh_areas) {
     this->item->setHidden(enabled == SETTING_DEPENDENCE_HIDE);
     this->item->setDisabled(enabled != SETTING_DEPENDENCE_ENABLE);
     this->setEnabled(enabled == SETTING_DEPENDENCE_ENABLE);
-    this->field->setEnabled(enabled == SETTING_DEPENDENCE_ENABLE && (!this->meta.list_only || !this->list.empty()));
+    const bool list_empty = this->model->rowCount() == 0;
+
+    this->field->setEnabled(enabled == SETTING_DEPENDENCE_ENABLE && (!this->meta.list_only || !list_empty));
     this->add_button->setEnabled(enabled == SETTING_DEPENDENCE_ENABLE && !this->field->text().isEmpty());
 
-    if (this->meta.list_only && this->list.empty()) {
+    if (this->meta.list_only && list_empty) {
         this->field->hide();
         this->add_button->hide();
     } else {
@@ -106,7 +162,8 @@ void WidgetSettingList::Refresh(RefreshAreas refresh_areas) {
 
     std::vector<EnabledNumberOrString> &value = this->data().value;
 
-    if (value != this->value_cached) {
+    // The child items added by the settings tree while the widget creation was deferred may no longer match the value
+    if (value != this->value_cached || this->item->childCount() != static_cast<int>(value.size())) {
         this->value_cached = value;
 
         this->tree->blockSignals(true);
@@ -154,21 +211,6 @@ bool WidgetSettingList::eventFilter(QObject *target, QEvent *event) {
     return this->field->eventFilter(target, event);
 }
 
-void WidgetSettingList::ResetCompleter() {
-    if (this->search != nullptr) this->search->deleteLater();
-
-    this->search = new QCompleter(ConvertValues(this->list), this);
-    this->search->setCompletionMode(QCompleter::PopupCompletion);
-    this->search->setModelSorting(QCompleter::CaseSensitivelySortedModel);
-    this->search->setFilterMode(Qt::MatchContains);
-    this->search->setCaseSensitivity(Qt::CaseSensitive);
-    this->search->setMaxVisibleItems(20);
-
-    this->field->setCompleter(this->search);
-
-    this->connect(this->search, SIGNAL(activated(const QString &)), this, SLOT(OnCompleted(const QString &)), Qt::QueuedConnection);
-}
-
 void WidgetSettingList::AddElement(EnabledNumberOrString &element) {
     QTreeWidgetItem *child = new QTreeWidgetItem();
     child->setSizeHint(0, QSize(0, ITEM_HEIGHT));
@@ -194,7 +236,7 @@ void WidgetSettingList::OnElementAppended() {
     const std::string entry = this->field->text().toStdString();
     if (entry.empty()) return;
 
-    if (this->meta.list_only && !IsValueFound(this->meta.list, entry)) {
+    if (this->meta.list_only && this->meta.FindValueIndex(entry) == -1) {
         QMessageBox alert;
         alert.setWindowTitle("Invalid value");
         alert.setText(format("'%s' setting doesn't accept '%s' as a value", this->meta.label.c_str(), entry.c_str()).c_str());
@@ -220,7 +262,7 @@ void WidgetSettingList::OnElementAppended() {
 
     value.push_back(entry);
     std::sort(value.begin(), value.end());
-    ::RemoveValue(this->list, entry);
+    this->model->Select(entry, true);
 
     emit itemChanged();
 }
@@ -242,7 +284,7 @@ void WidgetSettingList::OnTextEdited(const QString &value) {
 
 void WidgetSettingList::OnElementRemoved(const QString &element) {
     NumberOrString list_value(element.toStdString());
-    this->list.push_back(list_value);
+    this->model->Select(list_value, false);
 
     RemoveValue(this->data().value, EnabledNumberOrString(list_value));
 }
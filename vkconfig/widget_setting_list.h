@@ -30,6 +30,28 @@
 #include <QCompleter>
 #include <QLineEdit>
 #include <QPushButton>
+#include <QAbstractListModel>
+
+#include <vector>
+
+// Completion model of the values not selected yet. The values are read from the sorted list of the setting meta, which is
+// shared by all the widgets, and the selected values only flag their index in the list.
+class SettingListModel : public QAbstractListModel {
+    Q_OBJECT
+
+   public:
+    SettingListModel(const SettingMetaList &meta, const std::vector<EnabledNumberOrString> &value, QObject *parent);
+
+    void Select(const NumberOrString &value, bool selected);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+   private:
+    const SettingMetaList &meta;
+    std::vector<bool> selected;
+    std::vector<int> rows;  // Sorted indices of the values not selected yet
+};
 
 class WidgetSettingList : public WidgetSettingBase {
     Q_OBJECT
@@ -57,18 +79,17 @@ class WidgetSettingList : public WidgetSettingBase {
    private:
     void Resize();
     void AddElement(EnabledNumberOrString &element);
-    void ResetCompleter();
 
     SettingDataList &data();
 
     const SettingMetaList &meta;
     SettingDataSet &data_set;
 
+    SettingListModel *model;
     QCompleter *search;
     QLineEdit *field;
     QPushButton *add_button;
     QSize size;
 
-    std::vector<NumberOrString> list;
     std::vector<EnabledNumberOrString> value_cached;
 };
@@ -225,7 +225,7 @@ static std::string BuildPropertiesLog(const Layer& layer) {
     description += "- Layer Binary Path:\n    " + layer.binary_path + "\n";
     description += "\n";
     description +=
-        format("Total Settings Count: %d - Total Presets Count: %d", CountSettings(layer.settings), layer.presets.size());
+        format("Total Settings Count: %d - Total Presets Count: %d", CountSettings(layer.settings), layer.GetPresets().size());
     return description;
 }
 
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "builtin.h"
+
+#if VKCONFIG_BUILTIN_DATA
+#include <QCborValue>
+#include <QCborMap>
+#endif
+
+#include <cstring>
+
+#if VKCONFIG_BUILTIN_DATA
+// Generated by vkconfig_builtin_generator.py, sorted by path
+extern const BuiltinFile BUILTIN_FILES[];
+extern const std::size_t BUILTIN_FILE_COUNT;
+#endif
+
+const BuiltinFile* FindBuiltinFile(const std::string& path) {
+#if VKCONFIG_BUILTIN_DATA
+    if (path.compare(0, 2, ":/") != 0) return nullptr;
+
+    std::size_t first = 0;
+    std::size_t last = BUILTIN_FILE_COUNT;
+    while (first < last) {
+        const std::size_t middle = first + (last - first) / 2;
+        const int result = std::strcmp(BUILTIN_FILES[middle].path, path.c_str());
+        if (result == 0) return &BUILTIN_FILES[middle];
+
+        if (result < 0)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+#else
+    (void)path;
+#endif
+    return nullptr;
+}
+
+bool LoadBuiltinDocument(const std::string& path, QJsonDocument& document) {
+#if VKCONFIG_BUILTIN_DATA
+    const BuiltinFile* file = FindBuiltinFile(path);
+    if (file == nullptr) return false;
+
+    // The data is not copied, it's decoded from the static table
+    const QByteArray data = QByteArray::fromRawData(reinterpret_cast<const char*>(file->data), static_cast<int>(file->size));
+    document = QJsonDocument(QCborValue::fromCbor(data).toMap().toJsonObject());
+    return true;
+#else
+    (void)path;
+    (void)document;
+    return false;
+#endif
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#pragma once
+
+#include <QJsonDocument>
+
+#include <cstddef>
+#include <string>
+
+// Built-in layers manifests and configurations converted to CBOR at build time by vkconfig_builtin_generator.py
+struct BuiltinFile {
+    const char* path;  // Resource path of the JSON file
+    const unsigned char* data;
+    std::size_t size;
+};
+
+// Decode the built-in data of a resource JSON file, return false when the file is not built-in so that it's parsed as JSON
+bool LoadBuiltinDocument(const std::string& path, QJsonDocument& document);
+
+const BuiltinFile* FindBuiltinFile(const std::string& path);
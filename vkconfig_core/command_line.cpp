@@ -39,6 +39,7 @@ struct CommandHelpDesc {
 static const CommandHelpDesc command_help_desc[] = {
     {HELP_HELP, "help"},     {HELP_VERSION, "version"}, {HELP_GUI, "gui"},
     {HELP_LAYERS, "layers"}, {HELP_DOC, "doc"},         {HELP_RESET, "reset"},
+    {HELP_DAEMON, "daemon"},
 };
 
 static HelpType GetCommandHelpId(const char* token) {
@@ -69,6 +70,8 @@ static const ModeDesc mode_desc[] = {
     {COMMAND_LAYERS, "layers", HELP_LAYERS},        // COMMAND_LAYERS
     {COMMAND_DOC, "doc", HELP_DOC},                 // COMMAND_DOC
     {COMMAND_RESET, "reset", HELP_RESET},           // COMMAND_RESET
+    {COMMAND_DAEMON, "daemon", HELP_DAEMON},        // COMMAND_DAEMON
+    {COMMAND_DAEMON, "--daemon", HELP_DAEMON},      // COMMAND_DAEMON
     {COMMAND_VULKAN_SDK, "VULKAN_SDK", HELP_RESET}  // COMMAND_VULKAN_SDK
 };
 
@@ -138,6 +141,8 @@ static const CommandLayersDesc command_layers_desc[] = {
     {COMMAND_LAYERS_OVERRIDE, "-o", 3},
     {COMMAND_LAYERS_SURRENDER, "--surrender", 2},
     {COMMAND_LAYERS_SURRENDER, "-s", 2},
+    {COMMAND_LAYERS_BATCH, "--batch", 3},
+    {COMMAND_LAYERS_BATCH, "-b", 3},
 };
 
 struct CommandDocDesc {
@@ -150,6 +155,7 @@ static const CommandDocDesc command_doc_desc[] = {
     {COMMAND_DOC_HTML, "--html", 3},
     {COMMAND_DOC_MARKDOWN, "--markdown", 3},
     {COMMAND_DOC_SETTINGS, "--settings", 3},
+    {COMMAND_DOC_ALL, "--all", 2},
 };
 
 static CommandLayersArg GetCommandLayersId(const char* token) {
@@ -200,15 +206,18 @@ CommandLine::CommandLine(int argc, char* argv[])
       command_layers_arg(_command_layers_arg),
       command_doc_arg(_command_doc_arg),
       layers_configuration_path(_layers_configuration_path),
+      layers_script_path(_layers_script_path),
       command_vulkan_sdk(_command_vulkan_sdk),
       doc_layer_name(_doc_layer_name),
       doc_out_dir(_doc_out_dir),
+      daemon_server_name(_daemon_server_name),
       error(_error),
       error_args(_error_args),
       _command(COMMAND_GUI),
       _command_reset_arg(COMMAND_RESET_NONE),
       _command_layers_arg(COMMAND_LAYERS_NONE),
       _command_doc_arg(COMMAND_DOC_NONE),
+      _daemon_server_name(VKCONFIG_SHORT_NAME),
       _error(ERROR_NONE),
       _help(HELP_DEFAULT) {
     assert(argc >= 1);
@@ -256,8 +265,34 @@ CommandLine::CommandLine(int argc, char* argv[])
                 }
                 break;
             }
+
+            if (_command_layers_arg == COMMAND_LAYERS_BATCH) {
+                _layers_script_path = argv[arg_offset + 2];
+                if (_layers_script_path == "-") break;  // Read the script from stdin
+
+                QFile file(_layers_script_path.c_str());
+                const bool result = file.open(QFile::ReadOnly);
+                if (!result) {
+                    _error = ERROR_FILE_NOTFOUND;
+                    _error_args.push_back(argv[arg_offset + 2]);
+                }
+                break;
+            }
         } break;
         case COMMAND_DOC: {
+            // '--all' doesn't take a layer name, only the optional output dir
+            if (argc > arg_offset + 1 && GetCommandDocId(argv[arg_offset + 1]) == COMMAND_DOC_ALL) {
+                _command_doc_arg = COMMAND_DOC_ALL;
+                if (argc > arg_offset + 3) {
+                    _error = ERROR_TOO_MANY_COMMAND_ARGUMENTS;
+                    _error_args.push_back(argv[arg_offset + 0]);
+                    break;
+                }
+
+                _doc_out_dir = argc == arg_offset + 3 ? argv[arg_offset + 2] : ".";
+                break;
+            }
+
             if (argc <= arg_offset + 2) {
                 _error = ERROR_MISSING_COMMAND_ARGUMENT;
                 _error_args.push_back(argv[arg_offset + 0]);
@@ -286,6 +321,17 @@ CommandLine::CommandLine(int argc, char* argv[])
                 _doc_out_dir = ".";
 
         } break;
+        case COMMAND_DAEMON: {
+            if (argc > arg_offset + 2) {
+                _error = ERROR_TOO_MANY_COMMAND_ARGUMENTS;
+                _error_args.push_back(argv[arg_offset + 0]);
+                break;
+            }
+
+            if (argc == arg_offset + 2) {
+                _daemon_server_name = argv[arg_offset + 1];
+            }
+        } break;
         case COMMAND_RESET: {
             if (argc <= arg_offset + 1) {
                 _command_reset_arg = COMMAND_RESET_SOFT;
@@ -383,6 +429,7 @@ void CommandLine::usage() const {
             printf("\tlayers                    = Manage system Vulkan Layers.\n");
             printf("\tdoc                       = Create doc files for layer.\n");
             printf("\treset                     = Reset layers configurations.\n");
+            printf("\tdaemon                    = Run %s in the background to apply layers commands.\n", VKCONFIG_NAME);
             printf("\n");
             printf("  (Use 'vkconfig help <command>' for detailed usage of %s commands.)\n", VKCONFIG_NAME);
             break;
@@ -420,6 +467,7 @@ void CommandLine::usage() const {
             printf("\tvkconfig layers (--surrender | -s)\n");
             printf("\tvkconfig layers (--list | -l)\n");
             printf("\tvkconfig layers (--list-verbose | -lv)\n");
+            printf("\tvkconfig layers (--batch | -b) <script_file>\n");
             printf("\n");
             printf("Description\n");
             printf("\tvkconfig layers (--override | -o) <layers_configuration_file>\n");
@@ -433,6 +481,12 @@ void CommandLine::usage() const {
             printf("\n");
             printf("\tvkconfig layers (--list-version | -lv)\n");
             printf("\t\tList the Vulkan layers found by %s on the system with locations and versions.\n", VKCONFIG_NAME);
+            printf("\n");
+            printf("\tvkconfig layers (--batch | -b) <script_file>\n");
+            printf("\t\tLoad the Vulkan layers once and run the commands of <script_file>, one per line, or stdin if '-'.\n");
+            printf("\t\tCommands: 'configuration <layers_configuration_file>', 'override [<layers_configuration_file>]',\n");
+            printf("\t\t'apply <layers_configuration_name>', 'surrender' and 'reload'.\n");
+            printf("\t\tEmpty lines and lines starting with '#' are ignored.\n");
             break;
         }
         case HELP_DOC: {
@@ -443,6 +497,7 @@ void CommandLine::usage() const {
             printf("\tvkconfig doc --html <layer_name> [<output_dir>]\n");
             printf("\tvkconfig doc --markdown <layer_name> [<output_dir>]\n");
             printf("\tvkconfig doc --settings <layer_name> [<output_dir>]\n");
+            printf("\tvkconfig doc --all [<output_dir>]\n");
             printf("\n");
             printf("Description\n");
             printf("\tvkconfig doc --html <layer_name> [<output_dir>]\n");
@@ -456,6 +511,10 @@ void CommandLine::usage() const {
             printf("\tvkconfig doc --settings <layer_name> [<output_dir>]\n");
             printf("\t\tCreate the vk_layers_settings.txt file for the given layer.\n");
             printf("\t\tThe file is written to <output_dir>, or current directory if not specified.\n");
+            printf("\n");
+            printf("\tvkconfig doc --all [<output_dir>]\n");
+            printf("\t\tCreate the html and markdown documentation files of all the layers and an index.html page.\n");
+            printf("\t\tThe files are written to <output_dir>, or current directory if not specified.\n");
             break;
         }
         case HELP_RESET: {
@@ -475,6 +534,23 @@ void CommandLine::usage() const {
             printf("\n");
             break;
         }
+        case HELP_DAEMON: {
+            printf("Name\n");
+            printf("\t'daemon' - Keep %s running to apply layers commands received on a local socket\n", VKCONFIG_NAME);
+            printf("\n");
+            printf("Synopsis\n");
+            printf("\tvkconfig (daemon | --daemon) [<server_name>]\n");
+            printf("\n");
+            printf("Description\n");
+            printf("\tvkconfig (daemon | --daemon) [<server_name>]\n");
+            printf("\t\tLoad the Vulkan layers once, watch the layers directories and listen on the <server_name> local\n");
+            printf("\t\tsocket, '%s' if not specified. Each line received is a 'vkconfig layers --batch' command or 'quit'.\n",
+                   VKCONFIG_SHORT_NAME);
+            printf("\t\tEach command is answered by a single line: 'done', 'failed', 'invalid command'\n");
+            printf("\t\tor 'ignored' for the empty lines and the comments.\n");
+            printf("\n");
+            break;
+        }
     }
 }
 
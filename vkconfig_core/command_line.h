@@ -32,6 +32,7 @@ enum CommandType {
     COMMAND_RESET,
     COMMAND_LAYERS,
     COMMAND_DOC,
+    COMMAND_DAEMON,
     COMMAND_VULKAN_SDK
 };
 
@@ -40,10 +41,11 @@ enum CommandLayersArg {
     COMMAND_LAYERS_OVERRIDE,
     COMMAND_LAYERS_SURRENDER,
     COMMAND_LAYERS_LIST,
-    COMMAND_LAYERS_VERBOSE
+    COMMAND_LAYERS_VERBOSE,
+    COMMAND_LAYERS_BATCH
 };
 
-enum CommandDocArg { COMMAND_DOC_NONE = 0, COMMAND_DOC_HTML, COMMAND_DOC_MARKDOWN, COMMAND_DOC_SETTINGS };
+enum CommandDocArg { COMMAND_DOC_NONE = 0, COMMAND_DOC_HTML, COMMAND_DOC_MARKDOWN, COMMAND_DOC_SETTINGS, COMMAND_DOC_ALL };
 
 enum CommandResetArg { COMMAND_RESET_NONE = 0, COMMAND_RESET_SOFT, COMMAND_RESET_HARD };
 
@@ -57,7 +59,7 @@ enum CommandError {
     ERROR_FILE_NOTFOUND
 };
 
-enum HelpType { HELP_NONE, HELP_DEFAULT, HELP_HELP, HELP_VERSION, HELP_GUI, HELP_LAYERS, HELP_DOC, HELP_RESET };
+enum HelpType { HELP_NONE, HELP_DEFAULT, HELP_HELP, HELP_VERSION, HELP_GUI, HELP_LAYERS, HELP_DOC, HELP_RESET, HELP_DAEMON };
 
 class CommandLine {
    public:
@@ -70,10 +72,12 @@ class CommandLine {
     const CommandResetArg& command_reset_arg;
     const CommandLayersArg& command_layers_arg;
     const std::string& layers_configuration_path;
+    const std::string& layers_script_path;
     const CommandDocArg& command_doc_arg;
     const std::string& command_vulkan_sdk;
     const std::string& doc_layer_name;
     const std::string& doc_out_dir;
+    const std::string& daemon_server_name;
 
     const CommandError& error;
     const std::vector<std::string>& error_args;
@@ -86,10 +90,12 @@ class CommandLine {
     CommandResetArg _command_reset_arg;
     CommandLayersArg _command_layers_arg;
     std::string _layers_configuration_path;
+    std::string _layers_script_path;
     CommandDocArg _command_doc_arg;
     std::string _command_vulkan_sdk;
     std::string _doc_layer_name;
     std::string _doc_out_dir;
+    std::string _daemon_server_name;
 
     CommandError _error;
     std::vector<std::string> _error_args;
@@ -25,6 +25,7 @@
 #include "json.h"
 #include "platform.h"
 #include "version.h"
+#include "builtin.h"
 
 #include <QFile>
 #include <QFileInfo>
@@ -38,6 +39,7 @@
 #include <cstdio>
 #include <string>
 #include <algorithm>
+#include <unordered_map>
 
 static const char* SUPPORTED_CONFIG_FILES[] = {"_2_2_3", "_2_2_2", "_2_2_1"};
 
@@ -87,10 +89,12 @@ bool Configuration::Load2_2(const std::vector<Layer>& available_layers, const QJ
         }
     }
 
+    const KeyIndex<Layer> layer_index(available_layers);
+
     // Required configuration layers values
     const QJsonArray& json_layers_array = ReadArray(json_configuration_object, "layers");
-    for (int layer_index = 0, layer_count = json_layers_array.size(); layer_index < layer_count; ++layer_index) {
-        const QJsonObject& json_layer_object = json_layers_array[layer_index].toObject();
+    for (int position = 0, count = json_layers_array.size(); position < count; ++position) {
+        const QJsonObject& json_layer_object = json_layers_array[position].toObject();
 
         Parameter parameter;
         parameter.key = ReadStringValue(json_layer_object, "name").c_str();
@@ -102,9 +106,16 @@ bool Configuration::Load2_2(const std::vector<Layer>& available_layers, const QJ
             parameter.platform_flags = GetPlatformFlags(ReadStringArray(json_layer_object, "platforms"));
         }
 
-        const Layer* layer = FindByKey(available_layers, parameter.key.c_str());
+        const Layer* layer = layer_index.Find(available_layers, parameter.key.c_str());
         if (layer != nullptr) {
             CollectDefaultSettingData(layer->settings, parameter.settings);
+            parameter.settings_memory = layer->GetSettingsMemory();
+        }
+
+        std::unordered_map<std::string, SettingData*> setting_index;
+        setting_index.reserve(parameter.settings.size());
+        for (std::size_t i = 0, n = parameter.settings.size(); i < n; ++i) {
+            setting_index.insert(std::make_pair(parameter.settings[i]->key, parameter.settings[i]));
         }
 
         const QJsonArray& json_settings = ReadArray(json_layer_object, "settings");
@@ -114,8 +125,10 @@ bool Configuration::Load2_2(const std::vector<Layer>& available_layers, const QJ
             const std::string setting_key = ReadStringValue(json_setting_object, "key");
             const SettingType setting_type = GetSettingType(ReadStringValue(json_setting_object, "type").c_str());
 
-            SettingData* setting_data = FindSetting(parameter.settings, setting_key.c_str());
-            if (setting_data == nullptr) continue;
+            const auto it = setting_index.find(setting_key);
+            if (it == setting_index.end()) continue;
+
+            SettingData* setting_data = it->second;
 
             // Configuration type and layer type are differents, use layer default value
             if (setting_data->type != setting_type) continue;
@@ -135,17 +148,21 @@ bool Configuration::Load(const std::vector<Layer>& available_layers, const std::
 
     this->parameters.clear();
 
-    QFile file(full_path.c_str());
-    const bool result = file.open(QIODevice::ReadOnly | QIODevice::Text);
-    assert(result);
-    QString json_text = file.readAll();
-    file.close();
+    // Built-in configurations are decoded from the data generated at build time
+    QJsonDocument json_doc;
+    if (!LoadBuiltinDocument(full_path, json_doc)) {
+        QFile file(full_path.c_str());
+        const bool result = file.open(QIODevice::ReadOnly | QIODevice::Text);
+        assert(result);
+        QString json_text = file.readAll();
+        file.close();
 
-    QJsonParseError parse_error;
-    QJsonDocument json_doc = QJsonDocument::fromJson(json_text.toUtf8(), &parse_error);
+        QJsonParseError parse_error;
+        json_doc = QJsonDocument::fromJson(json_text.toUtf8(), &parse_error);
 
-    if (parse_error.error != QJsonParseError::NoError) {
-        return false;
+        if (parse_error.error != QJsonParseError::NoError) {
+            return false;
+        }
     }
 
     return Load2_2(available_layers, json_doc.object());
@@ -240,6 +257,39 @@ bool Configuration::Save(const std::vector<Layer>& available_layers, const std::
     }
 }
 
+bool Configuration::RefreshLayers(const std::vector<Layer>& available_layers, const std::vector<std::string>& layer_keys) {
+    bool updated = false;
+    for (std::size_t i = 0, n = this->parameters.size(); i < n; ++i) {
+        Parameter& parameter = this->parameters[i];
+        if (!IsStringFound(layer_keys, parameter.key)) continue;
+
+        SettingDataSet settings;
+        std::shared_ptr<const LayerSettingsMemory> settings_memory;
+
+        const Layer* layer = FindByKey(available_layers, parameter.key.c_str());
+        if (layer != nullptr) {
+            CollectDefaultSettingData(layer->settings, settings);
+            settings_memory = layer->GetSettingsMemory();
+        }
+
+        // Keep the values of the settings that are still defined by the layer with the same type
+        for (std::size_t j = 0, o = settings.size(); j < o; ++j) {
+            const SettingData* previous_setting = FindSetting(parameter.settings, settings[j]->key.c_str());
+            if (previous_setting != nullptr) settings[j]->Copy(previous_setting);
+        }
+
+        parameter.settings = settings;
+        parameter.settings_memory = settings_memory;  // The previous settings are deleted once no configuration uses them
+        updated = true;
+    }
+
+    if (updated) {
+        OrderParameter(this->parameters, available_layers);
+    }
+
+    return updated;
+}
+
 void Configuration::Reset(const std::vector<Layer>& available_layers, const PathManager& path_manager) {
     (void)path_manager;
 
@@ -39,6 +39,10 @@ class Configuration {
 
     void Reset(const std::vector<Layer>& available_layers, const PathManager& path_manager);
 
+    // Instantiate again the settings of the updated layers, the values of the existing settings are kept. The previous layers
+    // need to be alive until this is done.
+    bool RefreshLayers(const std::vector<Layer>& available_layers, const std::vector<std::string>& layer_keys);
+
     std::size_t Size() const { return this->parameters.size(); };
 
     std::string key;  // User readable display of the configuration name (may contain spaces)
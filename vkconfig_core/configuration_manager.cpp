@@ -56,9 +56,26 @@ void ConfigurationManager::LoadAllConfigurations(const std::vector<Layer> &avail
     RefreshConfiguration(available_layers);
 }
 
+void ConfigurationManager::LoadAllConfigurationsReadOnly(const std::vector<Layer> &available_layers) {
+    this->available_configurations.clear();
+    this->active_configuration = nullptr;
+
+    const std::string base_config_path = GetPath(BUILTIN_PATH_CONFIG_REF);
+
+    for (std::size_t i = 0, n = countof(SUPPORTED_CONFIG_FILES); i < n; ++i) {
+        const std::string path = base_config_path + SUPPORTED_CONFIG_FILES[i];
+        LoadConfigurationsPath(available_layers, path.c_str());
+    }
+
+    // The built-in configurations are only missing from the files before the GUI ran once or when the user removed them
+    LoadDefaultConfigurations(available_layers);
+}
+
 void ConfigurationManager::LoadDefaultConfigurations(const std::vector<Layer> &available_layers) {
     const QFileInfoList &configuration_files = GetJSONFiles(":/configurations/");
 
+    KeyIndex<Configuration> configuration_index(this->available_configurations);
+
     for (int i = 0, n = configuration_files.size(); i < n; ++i) {
         Configuration configuration;
         const bool result = configuration.Load(available_layers, configuration_files[i].absoluteFilePath().toStdString());
@@ -68,9 +85,9 @@ void ConfigurationManager::LoadDefaultConfigurations(const std::vector<Layer> &a
 
         OrderParameter(configuration.parameters, available_layers);
 
-        Configuration *found_configuration = FindByKey(this->available_configurations, configuration.key.c_str());
-        if (found_configuration == nullptr) {
+        if (!configuration_index.IsFound(configuration.key.c_str())) {
             this->available_configurations.push_back(configuration);
+            configuration_index.Insert(this->available_configurations, this->available_configurations.size() - 1);
         }
     }
 
@@ -92,6 +109,9 @@ void ConfigurationManager::SortConfigurations() {
 
 void ConfigurationManager::LoadConfigurationsPath(const std::vector<Layer> &available_layers, const char *path) {
     const QFileInfoList &configuration_files = GetJSONFiles(path);
+
+    KeyIndex<Configuration> configuration_index(this->available_configurations);
+
     for (int i = 0, n = configuration_files.size(); i < n; ++i) {
         const QFileInfo &info = configuration_files[i];
 
@@ -105,10 +125,11 @@ void ConfigurationManager::LoadConfigurationsPath(const std::vector<Layer> &avai
         const bool result = configuration.Load(available_layers, path);
         if (!result) continue;
 
-        if (FindByKey(available_configurations, configuration.key.c_str()) != nullptr) continue;
+        if (configuration_index.IsFound(configuration.key.c_str())) continue;
 
         OrderParameter(configuration.parameters, available_layers);
         available_configurations.push_back(configuration);
+        configuration_index.Insert(available_configurations, available_configurations.size() - 1);
     }
 }
 
@@ -256,6 +277,14 @@ void ConfigurationManager::RefreshConfiguration(const std::vector<Layer> &availa
     }
 }
 
+void ConfigurationManager::RefreshLayers(const std::vector<Layer> &available_layers, const std::vector<std::string> &layer_keys) {
+    if (layer_keys.empty()) return;
+
+    for (std::size_t i = 0, n = this->available_configurations.size(); i < n; ++i) {
+        this->available_configurations[i].RefreshLayers(available_layers, layer_keys);
+    }
+}
+
 bool ConfigurationManager::HasActiveConfiguration(const std::vector<Layer> &available_layers) const {
     std::string missing_layer;
     if (this->active_configuration != nullptr)
@@ -325,6 +354,8 @@ void ConfigurationManager::ReloadDefaultsConfigurations(const std::vector<Layer>
 void ConfigurationManager::FirstDefaultsConfigurations(const std::vector<Layer> &available_layers) {
     const QFileInfoList &configuration_files = GetJSONFiles(":/configurations/");
 
+    KeyIndex<Configuration> configuration_index(this->available_configurations);
+
     for (int i = 0, n = configuration_files.size(); i < n; ++i) {
         if (environment.IsDefaultConfigurationInit(configuration_files[i].baseName().toStdString())) {
             continue;
@@ -340,12 +371,13 @@ void ConfigurationManager::FirstDefaultsConfigurations(const std::vector<Layer>
             continue;
         }
 
-        if (FindByKey(available_configurations, configuration.key.c_str()) != nullptr) {
+        if (configuration_index.IsFound(configuration.key.c_str())) {
             continue;
         }
 
         OrderParameter(configuration.parameters, available_layers);
         available_configurations.push_back(configuration);
+        configuration_index.Insert(available_configurations, available_configurations.size() - 1);
     }
 
     RefreshConfiguration(available_layers);
@@ -369,29 +401,28 @@ bool ConfigurationManager::CompareLayersVersions(const std::vector<Layer> &avail
 
     bool result = true;
 
+    const KeyIndex<Layer> layer_index(available_layers);
+
     for (std::size_t param_index = 0, param_count = active_configuration->parameters.size(); param_index < param_count;
          ++param_index) {
         const Parameter &parameter = active_configuration->parameters[param_index];
 
         if (parameter.state != LAYER_STATE_OVERRIDDEN) continue;
 
-        for (std::size_t layer_index = 0, layer_count = available_layers.size(); layer_index < layer_count; ++layer_index) {
-            const Layer &layer = available_layers[layer_index];
-
-            if (layer.key == parameter.key) {
-                if (current_version == Version::VERSION_NULL) {
-                    current_version = layer.api_version;
-                }
+        const Layer *layer = layer_index.Find(available_layers, parameter.key.c_str());
+        if (layer == nullptr) continue;
 
-                if (is_less) {
-                    if (layer.api_version.GetMinor() > version.GetMinor()) result = false;
-                } else {
-                    if (layer.api_version.GetMinor() != current_version.GetMinor()) result = false;
-                }
+        if (current_version == Version::VERSION_NULL) {
+            current_version = layer->api_version;
+        }
 
-                log_versions += format("%s - %s\n", layer.key.c_str(), layer.api_version.str().c_str());
-            }
+        if (is_less) {
+            if (layer->api_version.GetMinor() > version.GetMinor()) result = false;
+        } else {
+            if (layer->api_version.GetMinor() != current_version.GetMinor()) result = false;
         }
+
+        log_versions += format("%s - %s\n", layer->key.c_str(), layer->api_version.str().c_str());
     }
 
     return result;
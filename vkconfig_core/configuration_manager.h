@@ -34,6 +34,10 @@ class ConfigurationManager {
 
     void LoadAllConfigurations(const std::vector<Layer>& available_layers);
 
+    // Load the configuration files and the built-in configurations without writing or removing any file and without changing
+    // the active configuration, so that the command line doesn't interfere with the configurations of the GUI.
+    void LoadAllConfigurationsReadOnly(const std::vector<Layer>& available_layers);
+
     void SaveAllConfigurations(const std::vector<Layer>& available_layers);
 
     Configuration& CreateConfiguration(const std::vector<Layer>& available_layers, const std::string& configuration_name,
@@ -53,6 +57,10 @@ class ConfigurationManager {
 
     void RefreshConfiguration(const std::vector<Layer>& available_layers);
 
+    // Instantiate again the settings of the layers updated by LayerManager::UpdateUserDefinedLayers or by LayerWatcher, the
+    // values of the existing settings are kept. The previous layers need to be alive until this is done.
+    void RefreshLayers(const std::vector<Layer>& available_layers, const std::vector<std::string>& layer_keys);
+
     void ResetDefaultsConfigurations(const std::vector<Layer>& available_layers);
 
     void ReloadDefaultsConfigurations(const std::vector<Layer>& available_layers);
@@ -24,6 +24,10 @@
 
 #include <QFileInfo>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 static std::string BuildPlatformsHtml(int platform_flags) {
     std::string text;
 
@@ -277,9 +281,25 @@ size_t GetNumSettings(const Layer& layer) {
     return rval;
 }
 
-void ExportHtmlDoc(const Layer& layer, const std::string& path) {
-    std::string text;
+// Documents are built in a single allocation most of the time: layer header plus a few table rows and paragraphs per setting
+static std::size_t EstimateDocSize(const Layer& layer) {
+    return 4096 + CountSettings(layer.settings) * 1024 + layer.GetPresets().size() * 512;
+}
 
+static bool WriteDocFile(const std::string& path, const std::string& text, const char* kind) {
+    QFile file(path.c_str());
+    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        file.write(text.data(), static_cast<qint64>(text.size()));
+        file.close();
+        printf("vkconfig: %s file written to %s\n", kind, path.c_str());
+        return true;
+    } else {
+        printf("vkconfig: could not write %s\n", path.c_str());
+        return false;
+    }
+}
+
+static void BuildHtmlDoc(std::string& text, const Layer& layer) {
     text += "<!DOCTYPE html>\n";
     text += "<html>\n";
     text += format("<head><title></title></head>\n", layer.key.c_str());
@@ -331,8 +351,8 @@ void ExportHtmlDoc(const Layer& layer, const std::string& path) {
     if (!layer.settings.empty()) {
         text += format("\t<li><a href=\"#settings\">Number of Layer Settings: %d</a></li>\n", GetNumSettings(layer));
     }
-    if (!layer.presets.empty()) {
-        text += format("\t<li><a href=\"#presets\">Number of Layer Presets: %d</a></li>\n", layer.presets.size());
+    if (!layer.GetPresets().empty()) {
+        text += format("\t<li><a href=\"#presets\">Number of Layer Presets: %d</a></li>\n", layer.GetPresets().size());
     }
     text += "</ul>\n";
 
@@ -351,10 +371,10 @@ void ExportHtmlDoc(const Layer& layer, const std::string& path) {
         WriteSettingsDetailsHtml(text, layer, layer.settings);
     }
 
-    if (!layer.presets.empty()) {
+    if (!layer.GetPresets().empty()) {
         text += "<h2><a id=\"presets\">Layer Presets</a></h2>\n";
-        for (std::size_t i = 0, n = layer.presets.size(); i < n; ++i) {
-            const LayerPreset& preset = layer.presets[i];
+        for (std::size_t i = 0, n = layer.GetPresets().size(); i < n; ++i) {
+            const LayerPreset& preset = layer.GetPresets()[i];
 
             text += format("<h3>%s</h3>\n", preset.label.c_str());
             text += format("<p>%s</p>", preset.description.c_str());
@@ -364,7 +384,7 @@ void ExportHtmlDoc(const Layer& layer, const std::string& path) {
 
             for (std::size_t j = 0, o = preset.settings.size(); j < o; ++j) {
                 const SettingData* data = preset.settings[j];
-                const SettingMeta* meta = FindSetting(layer.settings, data->key.c_str());
+                const SettingMeta* meta = layer.FindSettingMeta(data->key);
 
                 text += format("\t<li><a href=\"#%s-detailed\">%s</a>: <span class=\"code\">%s</span></li>\n", meta->key.c_str(),
                                meta->label.c_str(), data->Export(EXPORT_MODE_DOC).c_str());
@@ -376,20 +396,17 @@ void ExportHtmlDoc(const Layer& layer, const std::string& path) {
 
     text += "</body>\n";
     text += "</html>\n";
-
-    QFile file(path.c_str());
-    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        file.write(text.c_str());
-        file.close();
-        printf("vkconfig: html file written to %s\n", path.c_str());
-    } else {
-        printf("vkconfig: could not write %s\n", path.c_str());
-    }
 }
 
-void ExportMarkdownDoc(const Layer& layer, const std::string& path) {
+void ExportHtmlDoc(const Layer& layer, const std::string& path) {
     std::string text;
+    text.reserve(EstimateDocSize(layer));
+
+    BuildHtmlDoc(text, layer);
+    WriteDocFile(path, text, "html");
+}
 
+static void BuildMarkdownDoc(std::string& text, const Layer& layer) {
     text += format("## %s\n", layer.key.c_str());
 
     if (!layer.description.empty()) {
@@ -417,8 +434,8 @@ void ExportMarkdownDoc(const Layer& layer, const std::string& path) {
     if (!layer.settings.empty()) {
         text += format("- Number of Layer Settings: %d\n", layer.settings.size());
     }
-    if (!layer.presets.empty()) {
-        text += format("- Number of Layer Presets: %d\n", layer.presets.size());
+    if (!layer.GetPresets().empty()) {
+        text += format("- Number of Layer Presets: %d\n", layer.GetPresets().size());
     }
     text += "\n";
 
@@ -432,31 +449,108 @@ void ExportMarkdownDoc(const Layer& layer, const std::string& path) {
         WriteSettingsDetailsMarkdown(text, layer, layer.settings);
     }
 
-    if (!layer.presets.empty()) {
+    if (!layer.GetPresets().empty()) {
         text += "### Layer Presets\n";
-        for (std::size_t i = 0, n = layer.presets.size(); i < n; ++i) {
-            const LayerPreset& preset = layer.presets[i];
+        for (std::size_t i = 0, n = layer.GetPresets().size(); i < n; ++i) {
+            const LayerPreset& preset = layer.GetPresets()[i];
 
             text += "#### " + preset.label + "\n";
             text += preset.description + "\n";
             text += "##### Preset Setting Values:\n";
             for (std::size_t j = 0, o = preset.settings.size(); j < o; ++j) {
                 const SettingData* data = preset.settings[j];
-                const SettingMeta* meta = FindSetting(layer.settings, data->key.c_str());
+                const SettingMeta* meta = layer.FindSettingMeta(data->key);
 
                 text += "- " + meta->label + ": " + data->Export(EXPORT_MODE_DOC).c_str() + "\n";
             }
         }
     }
+}
 
-    QFile file(path.c_str());
-    if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-        file.write(text.c_str());
-        file.close();
-        printf("vkconfig: markdown file written to %s\n", path.c_str());
-    } else {
-        printf("vkconfig: could not write %s\n", path.c_str());
+void ExportMarkdownDoc(const Layer& layer, const std::string& path) {
+    std::string text;
+    text.reserve(EstimateDocSize(layer));
+
+    BuildMarkdownDoc(text, layer);
+    WriteDocFile(path, text, "markdown");
+}
+
+static void BuildIndexHtml(std::string& text, const std::vector<Layer>& available_layers) {
+    text += "<!DOCTYPE html>\n";
+    text += "<html>\n";
+    text += "<head><title>Vulkan Layers</title></head>\n";
+    text += "<body>\n";
+    text += "<style>\n";
+    text += "\ta {color: #A41E22;}\n";
+    text += "\th1 {color: #A41E22;}\n";
+    text += "\ttable {border: 1px solid; width: 100%; margin-left: auto; margin-right: auto;}\n";
+    text += "\ttd {border: 1px dotted;}\n";
+    text += "</style>\n";
+    text += "<h1>Vulkan Layers</h1>\n";
+    text += "<table><thead><tr>";
+    text += "<th>Layer</th><th>Description</th><th>API Version</th><th>Settings</th><th>Markdown</th>";
+    text += "</tr></thead><tbody>\n";
+
+    for (std::size_t i = 0, n = available_layers.size(); i < n; ++i) {
+        const Layer& layer = available_layers[i];
+
+        text += "<tr>\n";
+        text += format("\t<td><a href=\"%s.html\">%s</a></td>\n", layer.key.c_str(), layer.key.c_str());
+        text += "\t<td>" + layer.description + "</td>\n";
+        text += format("\t<td>%s</td>\n", layer.api_version.str().c_str());
+        text += format("\t<td>%d</td>\n", static_cast<int>(CountSettings(layer.settings)));
+        text += format("\t<td><a href=\"%s.md\">%s.md</a></td>\n", layer.key.c_str(), layer.key.c_str());
+        text += "</tr>\n";
+    }
+
+    text += "</tbody></table>\n";
+    text += "</body>\n";
+    text += "</html>\n";
+}
+
+bool ExportAllDoc(const std::vector<Layer>& available_layers, const std::string& path) {
+    std::atomic<std::size_t> next_layer(0);
+    std::atomic<bool> result(true);
+
+    // Each worker takes the next layer to document and reuses its buffers from one layer to the next
+    auto worker = [&]() {
+        std::string text;
+
+        for (std::size_t i = next_layer++, n = available_layers.size(); i < n; i = next_layer++) {
+            const Layer& layer = available_layers[i];
+            const std::size_t size = EstimateDocSize(layer);
+
+            text.clear();
+            text.reserve(size);
+            BuildHtmlDoc(text, layer);
+            if (!WriteDocFile(format("%s/%s.html", path.c_str(), layer.key.c_str()), text, "html")) result = false;
+
+            text.clear();
+            text.reserve(size);
+            BuildMarkdownDoc(text, layer);
+            if (!WriteDocFile(format("%s/%s.md", path.c_str(), layer.key.c_str()), text, "markdown")) result = false;
+        }
+    };
+
+    const std::size_t thread_count =
+        std::max<std::size_t>(1, std::min<std::size_t>(std::thread::hardware_concurrency(), available_layers.size()));
+
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count - 1);
+    for (std::size_t i = 1; i < thread_count; ++i) {
+        threads.push_back(std::thread(worker));
+    }
+    worker();  // The calling thread is a worker too
+    for (std::size_t i = 0, n = threads.size(); i < n; ++i) {
+        threads[i].join();
     }
+
+    std::string text;
+    text.reserve(2048 + available_layers.size() * 512);
+    BuildIndexHtml(text, available_layers);
+    if (!WriteDocFile(path + "/index.html", text, "html")) result = false;
+
+    return result;
 }
 
 void ExportSettingsDoc(const std::vector<Layer>& available_layers, const Configuration& configuration, const std::string& path) {
@@ -27,5 +27,8 @@ void ExportHtmlDoc(const Layer& layer, const std::string& path);
 
 void ExportMarkdownDoc(const Layer& layer, const std::string& path);
 
+// Export the html and markdown doc of all the layers and an html index page, the layers are exported concurrently
+bool ExportAllDoc(const std::vector<Layer>& available_layers, const std::string& path);
+
 void ExportSettingsDoc(const std::vector<Layer>& available_layers,
                        const Configuration& configuration, const std::string& path);
@@ -32,9 +32,11 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QSaveFile>
 #include <QTextStream>
 
 #include <cassert>
+#include <chrono>
 
 // Saved settings for the application
 #define VKCONFIG_KEY_INITIALIZE_FILES "FirstTimeRun"
@@ -136,6 +138,8 @@ Environment::Environment(PathManager& paths, const Version& api_version)
 }
 
 Environment::~Environment() {
+    this->SyncApplications(true);  // Don't save the applications which executables are missing
+
     const bool result = Save();
     assert(result);
 }
@@ -151,7 +155,7 @@ void Environment::Reset(ResetMode mode) {
                 actives[i] = GetActiveDefault(static_cast<Active>(i));
             }
 
-            applications = CreateDefaultApplications();
+            ResetApplications(CreateDefaultApplications());
 
             Set(ACTIVE_CONFIGURATION, "Validation");
             break;
@@ -257,6 +261,17 @@ bool Environment::Load() {
     return result;
 }
 
+// Run on a worker thread: on large application lists, searching each executable delays the user interface
+static std::unordered_set<std::string> FindMissingExecutables(const std::vector<std::string>& executable_paths) {
+    std::unordered_set<std::string> missing_executables;
+
+    for (std::size_t i = 0, n = executable_paths.size(); i < n; ++i) {
+        if (!QFileInfo::exists(executable_paths[i].c_str())) missing_executables.insert(executable_paths[i]);
+    }
+
+    return missing_executables;
+}
+
 bool Environment::LoadApplications() {
     const std::string& application_list_json = GetPath(BUILTIN_PATH_APPLIST);
     QFile file(application_list_json.c_str());
@@ -264,16 +279,19 @@ bool Environment::LoadApplications() {
         QString data = file.readAll();
         file.close();
 
-        applications.clear();
+        std::vector<Application> loaded_applications;
+        QJsonObject json_doc_object;
 
         if (!data.isEmpty()) {
             const QJsonDocument& json_doc = QJsonDocument::fromJson(data.toLocal8Bit());
             assert(json_doc.isObject());
             if (!json_doc.isEmpty()) {
                 // Get the list of apps
-                const QJsonObject& json_doc_object = json_doc.object();
+                json_doc_object = json_doc.object();
                 const QStringList& app_keys = json_doc_object.keys();
 
+                loaded_applications.reserve(app_keys.size());
+
                 for (int i = 0, n = app_keys.length(); i < n; ++i) {
                     const QJsonValue& app_value = json_doc_object.value(app_keys[i]);
                     const QJsonObject& app_object = app_value.toObject();
@@ -297,19 +315,86 @@ bool Environment::LoadApplications() {
                     const QJsonArray& args = app_object.value("command_lines").toArray();
                     application.arguments = args[0].toString().toStdString();
 
-                    applications.push_back(application);
+                    loaded_applications.push_back(application);
                 }
             }
         }
 
-        applications = RemoveMissingApplications(applications);
-        applications = UpdateDefaultApplications(applications);
-        if (applications.empty()) applications = CreateDefaultApplications();
+        std::vector<std::string> executable_paths;
+        executable_paths.reserve(loaded_applications.size());
+        for (std::size_t i = 0, n = loaded_applications.size(); i < n; ++i) {
+            executable_paths.push_back(loaded_applications[i].executable_path.c_str());
+        }
+
+        ResetApplications(loaded_applications);
+        this->applications_saved = json_doc_object;
+
+        // The missing applications are removed by SyncApplications
+        this->applications_check = std::async(std::launch::async, FindMissingExecutables, std::move(executable_paths));
+    }
+
+    return true;
+}
+
+bool Environment::SyncApplications(bool wait) {
+    if (!this->applications_check.valid()) return true;
+
+    if (!wait && this->applications_check.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+
+    // The executables are matched by path: the applications added, removed or edited during the search are kept
+    const std::unordered_set<std::string>& missing_executables = this->applications_check.get();
+
+    std::vector<Application> valid_applications;
+    valid_applications.reserve(this->applications.size());
+
+    // Remove applications that can't be found
+    for (std::size_t i = 0, n = this->applications.size(); i < n; ++i) {
+        if (missing_executables.count(this->applications[i].executable_path) > 0) continue;
+
+        valid_applications.push_back(this->applications[i]);
     }
 
+    valid_applications = UpdateDefaultApplications(valid_applications);
+    if (valid_applications.empty()) valid_applications = CreateDefaultApplications();
+
+    std::swap(this->applications, valid_applications);
+    BuildApplicationsIndex();
+
     return true;
 }
 
+void Environment::ResetApplications(const std::vector<Application>& new_applications) {
+    // Wait for a pending search to finish and drop its results, they don't match the new application list
+    if (this->applications_check.valid()) {
+        this->applications_check.wait();
+        this->applications_check = std::future<std::vector<bool> >();
+    }
+
+    this->applications = new_applications;
+    BuildApplicationsIndex();
+}
+
+void Environment::BuildApplicationsIndex() const {
+    this->applications_index.clear();
+    this->applications_index.reserve(this->applications.size());
+
+    for (std::size_t i = 0, n = this->applications.size(); i < n; ++i) {
+        this->applications_index.insert(std::make_pair(this->applications[i].app_name, i));  // Keep the first application found
+    }
+}
+
+int Environment::FindApplicationIndex(const std::string& app_name) const {
+    auto it = this->applications_index.find(app_name);
+
+    // Applications are renamed through GetApplication, so the index may be outdated
+    if (it == this->applications_index.end() || this->applications[it->second].app_name != app_name) {
+        BuildApplicationsIndex();
+        it = this->applications_index.find(app_name);
+    }
+
+    return it == this->applications_index.end() ? -1 : static_cast<int>(it->second);
+}
+
 bool Environment::Save() const {
     QSettings settings;
 
@@ -367,12 +452,18 @@ bool Environment::SaveApplications() const {
     const std::string& app_list_json = GetPath(BUILTIN_PATH_APPLIST);
     assert(QFileInfo(app_list_json.c_str()).absoluteDir().exists());
 
-    QFile file(app_list_json.c_str());
+    // The application list is saved on each environment save, but it rarely changes
+    if (root == this->applications_saved && QFileInfo::exists(app_list_json.c_str())) return true;
+
+    QSaveFile file(app_list_json.c_str());
     const bool result = file.open(QIODevice::WriteOnly | QIODevice::Text);
     assert(result);
     QJsonDocument doc(root);
     file.write(doc.toJson());
-    file.close();
+    const bool result_commit = file.commit();
+    assert(result_commit);
+
+    this->applications_saved = root;
 
     return true;
 }
@@ -384,13 +475,9 @@ void Environment::SelectActiveApplication(std::size_t application_index) {
 }
 
 int Environment::GetActiveApplicationIndex() const {
-    for (std::size_t i = 0, n = applications.size(); i < n; ++i) {
-        if (applications[i].app_name.c_str() == Get(ACTIVE_APPLICATION)) {
-            return static_cast<int>(i);
-        }
-    }
+    const int application_index = FindApplicationIndex(Get(ACTIVE_APPLICATION));
 
-    return 0;  // Not found, but the list is present, so return the first item.
+    return application_index < 0 ? 0 : application_index;  // Not found, but the list is present, so return the first item.
 }
 
 bool Environment::HasOverriddenApplications() const {
@@ -403,6 +490,7 @@ bool Environment::HasOverriddenApplications() const {
 
 bool Environment::AppendApplication(const Application& application) {
     applications.push_back(application);
+    applications_index.insert(std::make_pair(application.app_name, applications.size() - 1));
     return true;
 }
 
@@ -410,33 +498,22 @@ bool Environment::RemoveApplication(std::size_t application_index) {
     assert(!applications.empty());
     assert(application_index < applications.size());
 
-    if (applications.size() == 1u) {
-        applications.clear();
-        return true;
-    }
-
-    std::vector<Application> new_applications;
-    new_applications.reserve(applications.size() - 1);
-
-    for (std::size_t i = 0, n = applications.size(); i < n; ++i) {
-        if (i == application_index) continue;
-        new_applications.push_back(applications[i]);
-    }
-
-    std::swap(applications, new_applications);
+    applications.erase(applications.begin() + application_index);
+    BuildApplicationsIndex();
     return true;
 }
 
+const std::vector<Application>& Environment::GetApplications() const {
+    return applications;
+}
+
 const Application& Environment::GetActiveApplication() const {
-    assert(!applications.empty());
+    const int application_index = FindApplicationIndex(Get(ACTIVE_APPLICATION));
 
-    for (std::size_t i = 0, n = applications.size(); i < n; ++i) {
-        if (applications[i].app_name.c_str() == Get(ACTIVE_APPLICATION)) {
-            return applications[i];
-        }
-    }
+    assert(!applications.empty());
 
-    return applications[0];  // Not found, but the list is present, so return the first item.
+    // Not found, but the list is present, so return the first item.
+    return applications[application_index < 0 ? 0 : application_index];
 }
 
 const Application& Environment::GetApplication(std::size_t application_index) const {
@@ -648,22 +725,6 @@ std::vector<Application> Environment::CreateDefaultApplications() const {
     return new_applications;
 }
 
-std::vector<Application> Environment::RemoveMissingApplications(const std::vector<Application>& applications) const {
-    std::vector<Application> valid_applications;
-
-    // Remove applications that can't be found
-    for (std::size_t i = 0, n = applications.size(); i < n; ++i) {
-        const Application& application = applications[i];
-
-        const QFileInfo file_info(application.executable_path.c_str());
-        if (!file_info.exists()) continue;
-
-        valid_applications.push_back(application);
-    }
-
-    return valid_applications;
-}
-
 std::vector<Application> Environment::UpdateDefaultApplications(const std::vector<Application>& applications) const {
     std::vector<Application> search_applications;
     std::vector<Application> updated_applications = applications;
@@ -25,10 +25,14 @@
 #include "path_manager.h"
 
 #include <QByteArray>
+#include <QJsonObject>
 
 #include <array>
 #include <vector>
 #include <string>
+#include <future>
+#include <unordered_map>
+#include <unordered_set>
 
 enum OverrideFlag { OVERRIDE_FLAG_ACTIVE = (1 << 0), OVERRIDE_FLAG_SELECTED = (1 << 1), OVERRIDE_FLAG_PERSISTENT = (1 << 2) };
 
@@ -122,7 +126,11 @@ class Environment {
     bool AppendApplication(const Application& application);
     bool RemoveApplication(std::size_t application_index);
 
-    const std::vector<Application>& GetApplications() const { return applications; }
+    // Remove the applications which executables were not found by the search started by LoadApplications. Without 'wait',
+    // nothing is done and false is returned while the search is still running.
+    bool SyncApplications(bool wait);
+
+    const std::vector<Application>& GetApplications() const;
     const Application& GetActiveApplication() const;
     const Application& GetApplication(std::size_t application_index) const;
     Application& GetApplication(std::size_t application_index);
@@ -160,9 +168,6 @@ class Environment {
     bool IsDefaultConfigurationInit(const std::string& configuration_filename) const;
     void InitDefaultConfiguration(const std::string& configuration_filename);
 
-    // Search for all the applications in the list, an remove the application which executable can't be found
-    std::vector<Application> RemoveMissingApplications(const std::vector<Application>& applications) const;
-
    private:
     Environment(const Environment&) = delete;
     Environment& operator=(const Environment&) = delete;
@@ -174,7 +179,17 @@ class Environment {
     std::array<std::string, ACTIVE_COUNT> actives;
     std::array<QByteArray, LAYOUT_COUNT> layout_states;
     std::array<std::vector<std::string>, USER_DEFINED_LAYERS_PATHS_COUNT> user_defined_layers_paths;
+
+    // The applications executables are searched on a worker thread when the list is loaded. The missing applications are
+    // removed by SyncApplications.
     std::vector<Application> applications;
+    std::future<std::unordered_set<std::string> > applications_check;  // Executables not found
+    mutable std::unordered_map<std::string, std::size_t> applications_index;  // First application by name
+    mutable QJsonObject applications_saved;  // Content of applist.json, to only write the file when the list changed
+
+    void ResetApplications(const std::vector<Application>& new_applications);
+    void BuildApplicationsIndex() const;
+    int FindApplicationIndex(const std::string& app_name) const;
 
     PathManager& paths_manager;
 
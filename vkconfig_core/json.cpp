@@ -26,7 +26,7 @@
 
 #include <cassert>
 
-QJsonDocument ParseJsonFile(const char* file) {
+QJsonDocument ParseJsonFile(const char* file, std::string* error) {
     QFile file_schema(file);
     const bool result = file_schema.open(QIODevice::ReadOnly | QIODevice::Text);
     if (result) {
@@ -36,7 +36,11 @@ QJsonDocument ParseJsonFile(const char* file) {
         QJsonParseError json_parse_error;
         const QJsonDocument& json_document = QJsonDocument::fromJson(data.toUtf8(), &json_parse_error);
         if (json_document.isNull() || json_document.isEmpty()) {
-            Alert::FileNotJson(file);
+            if (error == nullptr) {
+                Alert::FileNotJson(file);
+            } else {
+                *error = format("%s is not a JSON file.", file);
+            }
         }
         return json_document;
     } else {
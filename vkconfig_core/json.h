@@ -27,7 +27,8 @@
 #include <string>
 #include <vector>
 
-QJsonDocument ParseJsonFile(const char* file);
+// When 'error' is provided, the error is returned in it instead of being shown with an alert
+QJsonDocument ParseJsonFile(const char* file, std::string* error = nullptr);
 
 // Read an object from the json_object
 QJsonObject ReadObject(const QJsonObject& json_object, const char* key);
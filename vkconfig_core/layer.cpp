@@ -35,6 +35,7 @@
 #include "json.h"
 #include "json_validator.h"
 #include "alert.h"
+#include "builtin.h"
 
 #include <QFile>
 #include <QDir>
@@ -45,7 +46,7 @@
 #include <string>
 #include <algorithm>
 
-static std::string GetBuiltinFolder(const Version& version) {
+static std::vector<int> GetBuiltinVersions() {
     QDir dir(":/layers");
     dir.setFilter(QDir::Dirs);
     QFileInfoList list = dir.entryInfoList();
@@ -60,6 +61,13 @@ static std::string GetBuiltinFolder(const Version& version) {
 
     std::sort(version_supported.begin(), version_supported.end());
 
+    return version_supported;
+}
+
+static std::string GetBuiltinFolder(const Version& version) {
+    // The resources don't change, they are only listed once. Layers may be loaded by several threads.
+    static const std::vector<int> version_supported = GetBuiltinVersions();
+
     const int searched_version = version.GetPatch();
 
     for (int i = static_cast<int>(version_supported.size()) - 1; i >= 0; --i) {
@@ -75,10 +83,22 @@ static std::string GetBuiltinFolder(const Version& version) {
 
 const char* Layer::NO_PRESET = "User-Defined Settings";
 
-Layer::Layer() : status(STATUS_STABLE), platforms(PLATFORM_DESKTOP_BIT), type(LAYER_TYPE_EXPLICIT) {}
+Layer::Layer()
+    : status(STATUS_STABLE),
+      platforms(PLATFORM_DESKTOP_BIT),
+      type(LAYER_TYPE_EXPLICIT),
+      features_loaded(true),
+      features_attempted(true),
+      load_error(nullptr) {}
 
 Layer::Layer(const std::string& key, const LayerType layer_type)
-    : key(key), status(STATUS_STABLE), platforms(PLATFORM_DESKTOP_BIT), type(layer_type) {}
+    : key(key),
+      status(STATUS_STABLE),
+      platforms(PLATFORM_DESKTOP_BIT),
+      type(layer_type),
+      features_loaded(true),
+      features_attempted(true),
+      load_error(nullptr) {}
 
 Layer::Layer(const std::string& key, const LayerType layer_type, const Version& file_format_version, const Version& api_version,
              const std::string& implementation_version, const std::string& library_path)
@@ -89,7 +109,10 @@ Layer::Layer(const std::string& key, const LayerType layer_type, const Version&
       implementation_version(implementation_version),
       status(STATUS_STABLE),
       platforms(PLATFORM_DESKTOP_BIT),
-      type(layer_type) {}
+      type(layer_type),
+      features_loaded(true),
+      features_attempted(true),
+      load_error(nullptr) {}
 
 // Todo: Load the layer with Vulkan API
 bool Layer::IsValid() const {
@@ -98,8 +121,9 @@ bool Layer::IsValid() const {
 }
 
 std::string Layer::FindPresetLabel(const SettingDataSet& settings) const {
-    for (std::size_t i = 0, n = this->presets.size(); i < n; ++i) {
-        if (HasPreset(settings, this->presets[i].settings)) return this->presets[i].label;
+    const std::vector<LayerPreset>& presets = this->GetPresets();
+    for (std::size_t i = 0, n = presets.size(); i < n; ++i) {
+        if (HasPreset(settings, presets[i].settings)) return presets[i].label;
     }
 
     return NO_PRESET;
@@ -154,35 +178,91 @@ SettingMeta* Layer::Instantiate(SettingMetaSet& meta_set, const std::string& key
     }
 
     assert(setting_meta != nullptr);
-    this->memory.push_back(std::shared_ptr<SettingMeta>(setting_meta));
+    LayerSettingsMemory& memory = this->GetMemory();
+    memory.settings.push_back(std::unique_ptr<SettingMeta>(setting_meta));
+    memory.setting_index.insert(std::make_pair(key, setting_meta));
     meta_set.push_back(setting_meta);
     return setting_meta;
 }
 
-/// Reports errors via a message box. This might be a bad idea?
-bool Layer::Load(const std::vector<Layer>& available_layers, const std::string& full_path_to_file, LayerType layer_type) {
+SettingMeta* Layer::FindSettingMeta(const std::string& key) {
+    if (this->memory == nullptr) return nullptr;
+
+    const auto it = this->memory->setting_index.find(key);
+    return it == this->memory->setting_index.end() ? nullptr : it->second;
+}
+
+const SettingMeta* Layer::FindSettingMeta(const std::string& key) const {
+    if (this->memory == nullptr) return nullptr;
+
+    const auto it = this->memory->setting_index.find(key);
+    return it == this->memory->setting_index.end() ? nullptr : it->second;
+}
+
+const std::vector<LayerPreset>& Layer::GetPresets() const {
+    static const std::vector<LayerPreset> NO_PRESETS;
+
+    return this->memory == nullptr ? NO_PRESETS : this->memory->presets;
+}
+
+// The memory is only allocated for the layers with settings or presets
+LayerSettingsMemory& Layer::GetMemory() {
+    if (this->memory == nullptr) {
+        this->memory = std::make_shared<LayerSettingsMemory>();
+    }
+
+    return *this->memory;
+}
+
+/// Reports errors via a message box, unless 'error' is provided to collect them
+bool Layer::Load(const std::vector<Layer>& available_layers, const std::string& full_path_to_file, LayerType layer_type,
+                 LayerLoadMode mode, std::string* error) {
+    this->load_error = error;
+    const bool result = this->LoadFile(available_layers, full_path_to_file, layer_type, mode);
+    this->load_error = nullptr;
+
+    return result;
+}
+
+void Layer::ReportInvalid(const std::string& message) const {
+    if (this->load_error == nullptr) {
+        Alert::LayerInvalid(this->manifest_path.c_str(), message.c_str());
+    } else {
+        if (!this->load_error->empty()) *this->load_error += "\n";
+        *this->load_error += message;
+    }
+}
+
+bool Layer::LoadFile(const std::vector<Layer>& available_layers, const std::string& full_path_to_file, LayerType layer_type,
+                     LayerLoadMode mode) {
     this->type = layer_type;  // Set layer type, no way to know this from the json file
 
     if (full_path_to_file.empty()) return false;
 
-    QFile file(full_path_to_file.c_str());
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        return false;
-    }
+    QString json_text;
+    QJsonDocument json_document;
 
-    QString json_text = file.readAll();
-    file.close();
+    // Built-in layers manifests are decoded from the data generated at build time
+    if (!LoadBuiltinDocument(full_path_to_file, json_document)) {
+        QFile file(full_path_to_file.c_str());
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            return false;
+        }
 
-    this->manifest_path = full_path_to_file;
+        json_text = file.readAll();
+        file.close();
 
-    // Convert the text to a JSON document & validate it.
-    // It does need to be a valid json formatted file.
-    QJsonParseError json_parse_error;
-    const QJsonDocument& json_document = QJsonDocument::fromJson(json_text.toUtf8(), &json_parse_error);
-    if (json_parse_error.error != QJsonParseError::NoError) {
-        return false;
+        // Convert the text to a JSON document & validate it.
+        // It does need to be a valid json formatted file.
+        QJsonParseError json_parse_error;
+        json_document = QJsonDocument::fromJson(json_text.toUtf8(), &json_parse_error);
+        if (json_parse_error.error != QJsonParseError::NoError) {
+            return false;
+        }
     }
 
+    this->manifest_path = full_path_to_file;
+
     // Make sure it's not empty
     if (json_document.isNull() || json_document.isEmpty()) {
         return false;
@@ -199,8 +279,7 @@ bool Layer::Load(const std::vector<Layer>& available_layers, const std::string&
 
     this->file_format_version = ReadVersionValue(json_root_object, "file_format_version");
     if (this->file_format_version.GetMajor() > 1) {
-        Alert::LayerInvalid(full_path_to_file.c_str(),
-                            format("Unsupported layer file format: %s", this->file_format_version.str().c_str()).c_str());
+        this->ReportInvalid(format("Unsupported layer file format: %s", this->file_format_version.str().c_str()));
         return false;
     }
 
@@ -219,17 +298,6 @@ bool Layer::Load(const std::vector<Layer>& available_layers, const std::string&
 
     this->api_version = ReadVersionValue(json_layer_object, "api_version");
 
-    const bool is_builtin_layer_file =
-        full_path_to_file.rfind(":/") == 0;  // Check whether the path start with ":/" for resource file paths.
-
-    JsonValidator validator;
-#if defined(_DEBUG)
-    const bool should_validate = (this->api_version >= Version(1, 2, 170) && is_builtin_layer_file) || !is_builtin_layer_file;
-#else
-    const bool should_validate = !is_builtin_layer_file;
-#endif
-    const bool is_valid = should_validate ? validator.Check(json_text) : true;
-
     const QJsonValue& json_library_path_value = json_layer_object.value("library_path");
     if (json_library_path_value != QJsonValue::Undefined) {
         this->binary_path = json_library_path_value.toString().toStdString();
@@ -250,9 +318,54 @@ bool Layer::Load(const std::vector<Layer>& available_layers, const std::string&
         this->url = ReadStringValue(json_layer_object, "url");
     }
 
+    // Keep the parsed manifest so that the features are loaded without reading and parsing the manifest again
+    if (mode == LAYER_LOAD_HEADER) {
+        this->features_loaded = false;
+        this->features_attempted = false;
+        this->features_json_text = json_text;
+        this->features_json_layer_object = json_layer_object;
+        return this->IsValid();
+    }
+
+    this->features_attempted = true;
+    if (!this->LoadFeatures(json_text, json_layer_object)) return false;
+
+    return this->IsValid();  // Not all JSON file are layer JSON valid
+}
+
+bool Layer::LoadFeatures() {
+    if (this->features_attempted) return this->features_loaded;
+
+    // A layer which failed to load its features is not loaded again so that the error is only reported once
+    this->features_attempted = true;
+
+    const QString json_text = this->features_json_text;
+    const QJsonObject json_layer_object = this->features_json_layer_object;
+    this->features_json_text.clear();
+    this->features_json_layer_object = QJsonObject();
+
+    return this->LoadFeatures(json_text, json_layer_object);
+}
+
+bool Layer::LoadFeatures(const QString& json_text, const QJsonObject& json_layer_object) {
+    assert(this->settings.empty());
+    assert(this->GetPresets().empty());
+
+    const bool is_builtin_layer_file =
+        this->manifest_path.rfind(":/") == 0;  // Check whether the path start with ":/" for resource file paths.
+
+    JsonValidator validator;
+#if defined(_DEBUG)
+    const bool should_validate = (this->api_version >= Version(1, 2, 170) && is_builtin_layer_file) || !is_builtin_layer_file;
+#else
+    const bool should_validate = !is_builtin_layer_file;
+#endif
+    // Built-in layers manifests decoded from the data generated at build time were validated when the data was generated
+    const bool is_valid = should_validate && !json_text.isEmpty() ? validator.Check(json_text) : true;
+
     if (!is_valid && this->key != "VK_LAYER_LUNARG_override") {
         if (!is_builtin_layer_file || (is_builtin_layer_file && this->api_version >= Version(1, 2, 170))) {
-            Alert::LayerInvalid(full_path_to_file.c_str(), validator.message.toStdString().c_str());
+            this->ReportInvalid(validator.message.toStdString());
             return false;
         }
     }
@@ -286,7 +399,7 @@ bool Layer::Load(const std::vector<Layer>& available_layers, const std::string&
                     AddSettingData((SettingDataSet&)preset.settings, json_setting_array[setting_index]);
                 }
 
-                this->presets.push_back(preset);
+                this->GetMemory().presets.push_back(preset);
             }
         }
     }
@@ -296,18 +409,20 @@ bool Layer::Load(const std::vector<Layer>& available_layers, const std::string&
         const std::string path = GetBuiltinFolder(this->api_version) + "/" + this->key + ".json";
 
         Layer default_layer;
-        if (default_layer.Load(available_layers, path, this->type)) {
+        if (default_layer.Load(std::vector<Layer>(), path, this->type, LAYER_LOAD_FULL, this->load_error)) {
             this->introduction = default_layer.introduction;
             this->url = default_layer.url;
             this->platforms = default_layer.platforms;
             this->status = default_layer.status;
             std::swap(this->settings, default_layer.settings);
-            std::swap(this->presets, default_layer.presets);
             this->memory = default_layer.memory;
         }
     }
 
-    return this->IsValid();  // Not all JSON file are layer JSON valid
+    // Only set once loaded so that a layer which failed to load its features is not taken for a layer without settings
+    this->features_loaded = true;
+
+    return true;
 }
 
 void CollectDefaultSettingData(const SettingMetaSet& meta_set, SettingDataSet& data_set) {
@@ -353,13 +468,19 @@ void Layer::AddSettingsSet(SettingMetaSet& settings, const SettingMeta* parent,
             const SettingMetaFileLoad& setting_file = static_cast<const SettingMetaFileLoad&>(*setting_meta);
             if (setting_file.format == "PROFILE") {
                 const std::string& value = ReplaceBuiltInVariable(setting_file.default_value);
-                const QJsonDocument& doc = ParseJsonFile(value.c_str());
+                std::string parse_error;
+                const QJsonDocument& doc = ParseJsonFile(value.c_str(), this->load_error == nullptr ? nullptr : &parse_error);
+                if (!parse_error.empty()) this->ReportInvalid(parse_error);
 
                 if (!doc.isNull() && !doc.isEmpty()) {
                     const QJsonObject& json_root_object = doc.object();
                     const std::string schema = json_root_object.value("$schema").toString().toStdString();
                     if (schema.find("https://schema.khronos.org/vulkan/profiles") == std::string::npos) {
-                        Alert::FileNotProfile(value.c_str());
+                        if (this->load_error == nullptr) {
+                            Alert::FileNotProfile(value.c_str());
+                        } else {
+                            this->ReportInvalid(format("%s is not a JSON profile file.", value.c_str()));
+                        }
                         return;
                     }
                 }
@@ -394,7 +515,7 @@ void Layer::AddSettingData(SettingDataSet& settings, const QJsonValue& json_sett
 
     const std::string& key = ReadStringValue(json_setting_object, "key");
 
-    SettingMeta* setting_meta = FindSetting(this->settings, key.c_str());
+    SettingMeta* setting_meta = this->FindSettingMeta(key);
     assert(setting_meta);
 
     SettingData* setting_data = setting_meta->Instantiate();
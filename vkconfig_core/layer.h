@@ -32,6 +32,21 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <unordered_map>
+
+// Settings metadata and presets created while loading a layer. They are immutable once the layer is loaded so that all the copies
+// of the layer share them instead of duplicating them.
+struct LayerSettingsMemory {
+    std::vector<std::unique_ptr<SettingMeta> > settings;
+    std::unordered_map<std::string, SettingMeta*> setting_index;  // All the settings by key
+    std::vector<LayerPreset> presets;
+};
+
+enum LayerLoadMode {
+    LAYER_LOAD_FULL = 0,  // Load the layer header, settings and presets
+    LAYER_LOAD_HEADER     // Only load the layer header, settings and presets are loaded by Layer::LoadFeatures
+};
 
 class Layer {
    public:
@@ -41,6 +56,8 @@ class Layer {
     Layer(const std::string& key, const LayerType layer_type);
     Layer(const std::string& key, const LayerType layer_type, const Version& file_format_version, const Version& api_version,
           const std::string& implementation_version, const std::string& library_path);
+    Layer(const Layer&) = default;
+    Layer(Layer&&) = default;
 
     bool IsValid() const;
 
@@ -52,6 +69,10 @@ class Layer {
 
     void AddSettingsSet(SettingMetaSet& meta_set, const SettingMeta* parent, const QJsonValue& json_settings_value);
 
+    // Find a setting of the layer, including child settings and enum values settings
+    SettingMeta* FindSettingMeta(const std::string& key);
+    const SettingMeta* FindSettingMeta(const std::string& key) const;
+
    public:
     std::string key;
     Version file_format_version;
@@ -68,14 +89,39 @@ class Layer {
     QJsonDocument profile;
 
     std::vector<SettingMeta*> settings;
-    std::vector<LayerPreset> presets;
 
-    bool Load(const std::vector<Layer>& available_layers, const std::string& full_path_to_file, LayerType layer_type);
+    const std::vector<LayerPreset>& GetPresets() const;
+
+    // When 'error' is provided, the errors are returned in it instead of being shown with an alert so that the layer can be
+    // loaded on a worker thread
+    bool Load(const std::vector<Layer>& available_layers, const std::string& full_path_to_file, LayerType layer_type,
+              LayerLoadMode mode = LAYER_LOAD_FULL, std::string* error = nullptr);
+
+    // Load the settings and presets of a layer loaded with LAYER_LOAD_HEADER from the manifest parsed by the header load. The
+    // features are only loaded once, a layer which failed to load them is not loaded again.
+    bool LoadFeatures();
+    bool IsFeaturesLoaded() const { return this->features_loaded; }
+    bool IsFeaturesAttempted() const { return this->features_attempted; }
+
+    // The settings metadata are shared by all copies of the layer and replaced only when the layer is loaded again
+    std::shared_ptr<const LayerSettingsMemory> GetSettingsMemory() const { return this->memory; }
 
    private:
     Layer& operator=(const Layer&) = delete;
 
-    std::vector<std::shared_ptr<SettingMeta> > memory;  // Settings are deleted when all layers instances are deleted.
+    bool LoadFile(const std::vector<Layer>& available_layers, const std::string& full_path_to_file, LayerType layer_type,
+                  LayerLoadMode mode);
+    bool LoadFeatures(const QString& json_text, const QJsonObject& json_layer_object);
+    void ReportInvalid(const std::string& message) const;
+    LayerSettingsMemory& GetMemory();
+
+    bool features_loaded;
+    bool features_attempted;
+    QString features_json_text;              // Only set after LAYER_LOAD_HEADER until the features are loaded
+    QJsonObject features_json_layer_object;  // Only set after LAYER_LOAD_HEADER until the features are loaded
+    std::string* load_error;  // Only set during Load when the errors are returned instead of shown
+
+    std::shared_ptr<LayerSettingsMemory> memory;  // Settings are deleted when all layers instances are deleted.
 };
 
 void CollectDefaultSettingData(const SettingMetaSet& meta_set, SettingDataSet& data_set);
@@ -25,8 +25,13 @@
 
 #include <QSettings>
 #include <QDir>
+#include <QFileInfo>
 #include <QStringList>
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
 /// Going back and forth between the Windows registry and looking for files
 /// in specific folders is just a mess. This class consolidates all that into
 /// one single abstraction that knows whether to look in the registry or in
@@ -84,87 +89,261 @@ static const char *SEARCH_PATHS[] = {"/usr/local/etc/vulkan/explicit_layer.d",
 
 LayerManager::LayerManager(const Environment &environment) : environment(environment) { available_layers.reserve(10); }
 
-void LayerManager::Clear() { available_layers.clear(); }
+void LayerManager::Clear() {
+    available_layers.clear();
+    layer_index.Clear();
+    loaded_user_defined_paths.clear();
+}
 
-bool LayerManager::Empty() const { return available_layers.empty(); }
+// On Linux/Mac, we also need the home folder
+static std::string GetSearchPath(const std::string &path) {
+    if (VKC_PLATFORM != VKC_PLATFORM_WINDOWS && !path.empty() && path[0] == '.') {
+        return QDir().homePath().toStdString() + "/" + path;
+    }
+    return path;
+}
 
-// Find all installed layers on the system.
-void LayerManager::LoadAllInstalledLayers() {
-    available_layers.clear();
+static bool IsLayerFromPath(const Layer &layer, const std::string &path) {
+    const QString layer_path = QDir::cleanPath(QFileInfo(layer.manifest_path.c_str()).absolutePath());
+    const QString search_path = QDir::cleanPath(QDir(GetSearchPath(path).c_str()).absolutePath());
+    return layer_path == search_path;
+}
+
+static QString GetManifestPath(const std::string &manifest_path) {
+    return QDir::cleanPath(QFileInfo(manifest_path.c_str()).absoluteFilePath());
+}
+
+static bool IsManifestFound(const std::vector<QString> &manifest_paths, const std::string &manifest_path) {
+    if (manifest_paths.empty()) return false;
+
+    return std::find(manifest_paths.begin(), manifest_paths.end(), GetManifestPath(manifest_path)) != manifest_paths.end();
+}
+
+// The layers are loaded in the search paths order, layers found in a previous path have precedence
+static std::size_t GetSearchPathRank(const std::vector<std::string> &search_paths, const Layer &layer) {
+    for (std::size_t i = 0, n = search_paths.size(); i < n; ++i) {
+        if (IsLayerFromPath(layer, search_paths[i])) return i;
+    }
+    return search_paths.size();  // Layers found in the registry
+}
+
+std::vector<std::string> LayerManager::GetSearchPaths() const {
+    std::vector<std::string> search_paths;
 
     // FIRST: If VK_LAYER_PATH is set it has precedence over other layers.
     const std::vector<std::string> &env_user_defined_layers_paths_set =
         environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_ENV_SET);
-    for (std::size_t i = 0, n = env_user_defined_layers_paths_set.size(); i < n; ++i) {
-        LoadLayersFromPath(env_user_defined_layers_paths_set[i]);
-    }
+    search_paths.insert(search_paths.end(), env_user_defined_layers_paths_set.begin(), env_user_defined_layers_paths_set.end());
 
     // SECOND: Any per layers configuration user-defined path from Vulkan Configurator? Search for those too
     const std::vector<std::string> &gui_config_user_defined_layers_paths =
         environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_GUI);
-    for (std::size_t i = 0, n = gui_config_user_defined_layers_paths.size(); i < n; ++i) {
-        LoadLayersFromPath(gui_config_user_defined_layers_paths[i]);
-    }
+    search_paths.insert(search_paths.end(), gui_config_user_defined_layers_paths.begin(),
+                        gui_config_user_defined_layers_paths.end());
 
     // THIRD: Add VK_ADD_LAYER_PATH layers
     const std::vector<std::string> &env_user_defined_layers_paths_add =
         environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_ENV_ADD);
-    for (std::size_t i = 0, n = env_user_defined_layers_paths_add.size(); i < n; ++i) {
-        LoadLayersFromPath(env_user_defined_layers_paths_add[i]);
-    }
+    search_paths.insert(search_paths.end(), env_user_defined_layers_paths_add.begin(), env_user_defined_layers_paths_add.end());
 
     // FOURTH: Standard layer paths, in standard locations. The above has always taken precedence
     for (std::size_t i = 0, n = countof(SEARCH_PATHS); i < n; i++) {
-        LoadLayersFromPath(SEARCH_PATHS[i]);
+        search_paths.push_back(GetSearchPath(SEARCH_PATHS[i]));
     }
 
     // FIFTH: See if thee is anyting in the VULKAN_SDK path that wasn't already found elsewhere
     if (!qgetenv("VULKAN_SDK").isEmpty()) {
-        LoadLayersFromPath(GetPath(BUILTIN_PATH_EXPLICIT_LAYERS));
+        search_paths.push_back(GetPath(BUILTIN_PATH_EXPLICIT_LAYERS));
     }
+
+    return search_paths;
 }
 
-// Load a single layer
-void LayerManager::LoadLayer(const std::string &layer_name) {
-    available_layers.clear();
+bool LayerManager::Empty() const { return available_layers.empty(); }
 
-    // FIRST: If VK_LAYER_PATH is set it has precedence over other layers.
-    const std::vector<std::string> &env_user_defined_layers_paths_set =
-        environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_ENV_SET);
-    for (std::size_t i = 0, n = env_user_defined_layers_paths_set.size(); i < n; ++i) {
-        if (LoadLayerFromPath(layer_name, env_user_defined_layers_paths_set[i])) return;
+Layer *LayerManager::FindLayer(const std::string &layer_name) {
+    Layer *layer = layer_index.Find(available_layers, layer_name.c_str());
+    if (layer != nullptr && !layer->IsFeaturesLoaded()) {
+        layer->LoadFeatures();
     }
+    return layer;
+}
 
-    // SECOND: Any per layers configuration user-defined path from Vulkan Configurator? Search for those too
-    const std::vector<std::string> &gui_config_user_defined_layers_paths =
-        environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_GUI);
-    for (std::size_t i = 0, n = gui_config_user_defined_layers_paths.size(); i < n; ++i) {
-        if (LoadLayerFromPath(layer_name, gui_config_user_defined_layers_paths[i])) return;
+const Layer *LayerManager::FindLayerHeader(const std::string &layer_name) const {
+    return layer_index.Find(available_layers, layer_name.c_str());
+}
+
+// Find all installed layers on the system.
+void LayerManager::LoadAllInstalledLayers(LayerLoadMode mode) {
+    this->Clear();
+
+    const std::vector<std::string> &search_paths = this->GetSearchPaths();
+    for (std::size_t i = 0, n = search_paths.size(); i < n; ++i) {
+        LoadLayersFromPath(search_paths[i], mode);
     }
 
-    // THIRD: Add VK_ADD_LAYER_PATH layers
-    const std::vector<std::string> &env_user_defined_layers_paths_add =
-        environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_ENV_ADD);
-    for (std::size_t i = 0, n = env_user_defined_layers_paths_add.size(); i < n; ++i) {
-        if (LoadLayerFromPath(layer_name, env_user_defined_layers_paths_add[i])) return;
+    this->loaded_user_defined_paths = environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_GUI);
+}
+
+std::vector<std::string> LayerManager::UpdateUserDefinedLayers(LayerLoadMode mode) {
+    const std::vector<std::string> &paths = environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_GUI);
+    const std::vector<std::string> previous_paths = this->loaded_user_defined_paths;
+
+    std::vector<std::string> added_paths;
+    std::vector<std::string> kept_paths;
+    for (std::size_t i = 0, n = paths.size(); i < n; ++i) {
+        if (IsStringFound(previous_paths, paths[i]))
+            kept_paths.push_back(paths[i]);
+        else
+            added_paths.push_back(paths[i]);
     }
 
-    // FOURTH: Standard layer paths, in standard locations. The above has always taken precedence
-    for (std::size_t i = 0, n = countof(SEARCH_PATHS); i < n; i++) {
-        if (LoadLayerFromPath(layer_name, SEARCH_PATHS[i])) return;
+    std::vector<std::string> removed_paths;
+    std::vector<std::string> previous_kept_paths;
+    for (std::size_t i = 0, n = previous_paths.size(); i < n; ++i) {
+        if (IsStringFound(paths, previous_paths[i]))
+            previous_kept_paths.push_back(previous_paths[i]);
+        else
+            removed_paths.push_back(previous_paths[i]);
     }
 
-    // FIFTH: See if thee is anyting in the VULKAN_SDK path that wasn't already found elsewhere
-    if (!qgetenv("VULKAN_SDK").isEmpty()) {
-        if (LoadLayerFromPath(layer_name, GetPath(BUILTIN_PATH_EXPLICIT_LAYERS))) return;
+    std::vector<std::string> updated_layers;
+
+    if (added_paths.empty() && removed_paths.empty()) return updated_layers;
+
+    // Reordering the paths changes the precedence of all their layers
+    if (kept_paths != previous_kept_paths) {
+        for (std::size_t i = 0, n = available_layers.size(); i < n; ++i) {
+            updated_layers.push_back(available_layers[i].key);
+        }
+
+        this->LoadAllInstalledLayers(mode);
+
+        for (std::size_t i = 0, n = available_layers.size(); i < n; ++i) {
+            if (!IsStringFound(updated_layers, available_layers[i].key)) updated_layers.push_back(available_layers[i].key);
+        }
+        return updated_layers;
+    }
+
+    // Load the layers of the added paths only, the layers are merged by precedence with the loaded layers
+    std::vector<Layer> added_layers;
+    for (std::size_t i = 0, n = added_paths.size(); i < n; ++i) {
+        const PathFinder file_list(GetSearchPath(added_paths[i]), true);
+
+        for (int j = 0, o = file_list.FileCount(); j < o; ++j) {
+            Layer layer;
+            if (!LoadManifest(layer, file_list.GetFileName(j), mode)) continue;
+
+            added_layers.push_back(std::move(layer));
+        }
+    }
+
+    this->loaded_user_defined_paths = paths;
+
+    return this->MergeLayers(added_layers, removed_paths, std::vector<std::string>());
+}
+
+std::vector<std::string> LayerManager::UpdateLayerManifests(std::vector<Layer> &loaded_layers,
+                                                            const std::vector<std::string> &removed_manifests) {
+    if (loaded_layers.empty() && removed_manifests.empty()) return std::vector<std::string>();
+
+    return this->MergeLayers(loaded_layers, std::vector<std::string>(), removed_manifests);
+}
+
+bool LayerManager::LoadManifest(Layer &layer, const std::string &manifest_path, LayerLoadMode mode, std::string *error) {
+    const QString directory = QFileInfo(manifest_path.c_str()).absolutePath();
+
+    LayerType type = LAYER_TYPE_USER_DEFINED;
+    if (directory.contains("explicit", Qt::CaseInsensitive)) type = LAYER_TYPE_EXPLICIT;
+    if (directory.contains("implicit", Qt::CaseInsensitive)) type = LAYER_TYPE_IMPLICIT;
+
+    // Loaded without the current layers so that a layer with the same key can replace a layer with a lower precedence
+    return layer.Load(std::vector<Layer>(), manifest_path, type, mode, error);
+}
+
+std::vector<std::string> LayerManager::MergeLayers(std::vector<Layer> &added_layers, const std::vector<std::string> &removed_paths,
+                                                   const std::vector<std::string> &removed_manifests) {
+    const std::vector<std::string> &search_paths = this->GetSearchPaths();
+
+    std::vector<QString> removed_manifest_paths;
+    for (std::size_t i = 0, n = removed_manifests.size(); i < n; ++i) {
+        removed_manifest_paths.push_back(GetManifestPath(removed_manifests[i]));
+    }
+
+    // When several added layers have the same key, the layer found in the path with the highest precedence is used
+    std::unordered_map<std::string, std::size_t> added_layer_index;
+    for (std::size_t i = 0, n = added_layers.size(); i < n; ++i) {
+        auto it = added_layer_index.find(added_layers[i].key);
+        if (it == added_layer_index.end()) {
+            added_layer_index.insert(std::make_pair(added_layers[i].key, i));
+        } else if (GetSearchPathRank(search_paths, added_layers[i]) < GetSearchPathRank(search_paths, added_layers[it->second])) {
+            it->second = i;
+        }
+    }
+
+    // Layers can't be assigned, the list of layers is rebuilt with the removed layers dropped and the replaced layers moved
+    std::vector<bool> added_layer_used(added_layers.size(), false);
+    std::vector<std::string> updated_layers;
+    std::vector<std::string> removed_layers;
+
+    std::vector<Layer> layers;
+    layers.reserve(available_layers.size() + added_layers.size());
+
+    for (std::size_t i = 0, n = available_layers.size(); i < n; ++i) {
+        Layer &layer = available_layers[i];
+
+        bool removed = IsManifestFound(removed_manifest_paths, layer.manifest_path);
+        for (std::size_t j = 0, o = removed_paths.size(); j < o && !removed; ++j) {
+            removed = IsLayerFromPath(layer, removed_paths[j]);
+        }
+
+        // An updated manifest is both removed and added, its layer is replaced in place
+        auto it = added_layer_index.find(layer.key);
+        Layer *added_layer = it == added_layer_index.end() ? nullptr : &added_layers[it->second];
+        if (added_layer != nullptr &&
+            (removed || GetSearchPathRank(search_paths, *added_layer) < GetSearchPathRank(search_paths, layer))) {
+            added_layer_used[it->second] = true;
+            updated_layers.push_back(layer.key);
+            layers.push_back(std::move(*added_layer));
+        } else if (removed) {
+            updated_layers.push_back(layer.key);
+            removed_layers.push_back(layer.key);
+        } else {
+            layers.push_back(std::move(layer));
+        }
     }
+
+    KeyIndex<Layer> layer_index(layers);
+    for (std::size_t i = 0, n = added_layers.size(); i < n; ++i) {
+        if (added_layer_used[i]) continue;
+        if (added_layer_index[added_layers[i].key] != i) continue;
+        if (layer_index.IsFound(added_layers[i].key.c_str())) continue;
+
+        updated_layers.push_back(added_layers[i].key);
+        layers.push_back(std::move(added_layers[i]));
+    }
+
+    this->available_layers.swap(layers);
+    this->layer_index.Build(this->available_layers);
+
+    // A removed layer may have been hiding a layer with the same key in a path with a lower precedence
+    this->LoadLayersFromPaths(removed_layers, search_paths);
+
+    return updated_layers;
+}
+
+// Load a single layer
+void LayerManager::LoadLayer(const std::string &layer_name) {
+    this->Clear();
+
+    this->LoadLayersFromPaths(std::vector<std::string>(1, layer_name), this->GetSearchPaths());
 }
 
 /// Search a folder and load up all the layers found there. This does NOT
 /// load the default settings for each layer. This is just a master list of
 /// layers found. Do NOT load duplicate layer names. The type of layer (explicit or implicit) is
 /// determined from the path name.
-void LayerManager::LoadLayersFromPath(const std::string &path) {
+void LayerManager::LoadLayersFromPath(const std::string &path, LayerLoadMode mode) {
     // On Windows custom files are in the file system. On non Windows all layers are
     // searched this way
     LayerType type = LAYER_TYPE_USER_DEFINED;
@@ -177,63 +356,54 @@ void LayerManager::LoadLayersFromPath(const std::string &path) {
         if (QString(path.c_str()).contains("...")) {
 #if VKC_PLATFORM == VKC_PLATFORM_WINDOWS
             LoadRegistryLayers(path.c_str(), available_layers, type);
+            layer_index.Build(available_layers);
 #endif
             return;
         }
 
         file_list = PathFinder(path, (type == LAYER_TYPE_USER_DEFINED));
     } else if (VKC_PLATFORM == VKC_PLATFORM_LINUX || VKC_PLATFORM == VKC_PLATFORM_MACOS) {
-        // On Linux/Mac, we also need the home folder
-        std::string search_path = path;
-        if (path[0] == '.') {
-            search_path = QDir().homePath().toStdString() + "/" + path;
-        }
-
-        file_list = PathFinder(search_path, true);
+        file_list = PathFinder(GetSearchPath(path), true);
     } else {
         assert(0);  // Platform unknown
     }
 
     for (int i = 0, n = file_list.FileCount(); i < n; ++i) {
         Layer layer;
-        if (layer.Load(available_layers, file_list.GetFileName(i).c_str(), type)) {
+        if (layer.Load(available_layers, file_list.GetFileName(i).c_str(), type, mode)) {
             // Make sure this layer name has not already been added
-            if (FindByKey(available_layers, layer.key.c_str()) != nullptr) continue;
+            if (layer_index.IsFound(layer.key.c_str())) continue;
 
             // Good to go, add the layer
-            available_layers.push_back(layer);
+            available_layers.push_back(std::move(layer));
+            layer_index.Insert(available_layers, available_layers.size() - 1);
         }
     }
 }
 
-// Attempt to load the named layer from the given path
-bool LayerManager::LoadLayerFromPath(const std::string &layer_name, const std::string &path) {
-    LayerType type = LAYER_TYPE_USER_DEFINED;
-    if (QString(path.c_str()).contains("explicit", Qt::CaseInsensitive)) type = LAYER_TYPE_EXPLICIT;
-    if (QString(path.c_str()).contains("implicit", Qt::CaseInsensitive)) type = LAYER_TYPE_IMPLICIT;
+// Attempt to load the named layers from the given paths
+void LayerManager::LoadLayersFromPaths(const std::vector<std::string> &layer_names, const std::vector<std::string> &paths) {
+    std::unordered_set<std::string> missing_layers(layer_names.begin(), layer_names.end());
 
-    PathFinder file_list;
+    for (std::size_t i = 0, n = paths.size(); i < n && !missing_layers.empty(); ++i) {
+        LayerType type = LAYER_TYPE_USER_DEFINED;
+        if (QString(paths[i].c_str()).contains("explicit", Qt::CaseInsensitive)) type = LAYER_TYPE_EXPLICIT;
+        if (QString(paths[i].c_str()).contains("implicit", Qt::CaseInsensitive)) type = LAYER_TYPE_IMPLICIT;
 
-    if (VKC_PLATFORM == VKC_PLATFORM_LINUX || VKC_PLATFORM == VKC_PLATFORM_MACOS) {
-        // On Linux/Mac, we also need the home folder
-        std::string search_path = path;
-        if (path[0] == '.') {
-            search_path = QDir().homePath().toStdString() + "/" + path;
-        }
-        file_list = PathFinder(search_path, true);
-    } else {
-        file_list = PathFinder(path, true);
-    }
+        const PathFinder file_list(GetSearchPath(paths[i]), true);
 
-    for (int i = 0, n = file_list.FileCount(); i < n; ++i) {
-        Layer layer;
-        if (layer.Load(available_layers, file_list.GetFileName(i).c_str(), type)) {
-            // Add this layer if the layer name matches, then return
-            if (layer_name == layer.key) {
-                available_layers.push_back(layer);
-                return true;
-            }
+        for (int j = 0, o = file_list.FileCount(); j < o && !missing_layers.empty(); ++j) {
+            // Only the header is needed to find the layer, other layers are skipped without loading their settings
+            Layer layer;
+            if (!layer.Load(available_layers, file_list.GetFileName(j).c_str(), type, LAYER_LOAD_HEADER)) continue;
+
+            auto it = missing_layers.find(layer.key);
+            if (it == missing_layers.end()) continue;
+            if (!layer.LoadFeatures()) continue;
+
+            missing_layers.erase(it);
+            available_layers.push_back(std::move(layer));
+            layer_index.Insert(available_layers, available_layers.size() - 1);
         }
     }
-    return false;
 }
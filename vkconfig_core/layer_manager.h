@@ -22,6 +22,7 @@
 
 #include "layer.h"
 #include "environment.h"
+#include "util.h"
 
 #include <QStringList>
 
@@ -36,13 +37,44 @@ class LayerManager {
     void Clear();
     bool Empty() const;
 
-    void LoadAllInstalledLayers();
+    void LoadAllInstalledLayers(LayerLoadMode mode = LAYER_LOAD_FULL);
+
+    // Only scan the per-configuration user-defined paths added or removed since the layers were loaded, return the keys of the
+    // layers added, replaced or removed. The settings of these layers need to be instantiated again by the configurations.
+    std::vector<std::string> UpdateUserDefinedLayers(LayerLoadMode mode = LAYER_LOAD_FULL);
+
+    // Merge the layers of the added or updated manifests and drop the layers of the removed manifests, return the keys of the
+    // layers added, replaced or removed. The settings of these layers need to be instantiated again by the configurations.
+    std::vector<std::string> UpdateLayerManifests(std::vector<Layer>& loaded_layers,
+                                                  const std::vector<std::string>& removed_manifests);
     void LoadLayer(const std::string& layer_name);
-    void LoadLayersFromPath(const std::string& path);
+    void LoadLayersFromPath(const std::string& path, LayerLoadMode mode = LAYER_LOAD_FULL);
 
-    std::vector<Layer> available_layers;
+    // Layers loaded with LAYER_LOAD_HEADER get their settings and presets loaded when found
+    Layer* FindLayer(const std::string& layer_name);
+
+    // Only the header of the layer is loaded, layers loaded with LAYER_LOAD_HEADER may not have their settings and presets
+    const Layer* FindLayerHeader(const std::string& layer_name) const;
+
+    // All the layers paths, ordered by precedence
+    std::vector<std::string> GetSearchPaths() const;
+
+    // Load a layer manifest independently of the loaded layers. Without 'error' the manifest errors are shown with an alert which
+    // requires the GUI thread, with 'error' they are returned in it instead and the manifest can be loaded on a worker thread.
+    static bool LoadManifest(Layer& layer, const std::string& manifest_path, LayerLoadMode mode = LAYER_LOAD_FULL,
+                             std::string* error = nullptr);
+
+    // The layers can only be changed by LayerManager so that 'layer_index' stays in sync with them
+    const std::vector<Layer>& GetLayers() const { return this->available_layers; }
 
     const Environment& environment;
    private:
-    bool LoadLayerFromPath(const std::string& layer_name, const std::string& path);
+    // Load each named layer from the first path it is found in, each path is scanned once for all the layers
+    void LoadLayersFromPaths(const std::vector<std::string>& layer_names, const std::vector<std::string>& paths);
+    std::vector<std::string> MergeLayers(std::vector<Layer>& added_layers, const std::vector<std::string>& removed_paths,
+                                         const std::vector<std::string>& removed_manifests);
+
+    std::vector<Layer> available_layers;
+    KeyIndex<Layer> layer_index;
+    std::vector<std::string> loaded_user_defined_paths;  // Per-configuration user-defined paths of 'available_layers'
 };
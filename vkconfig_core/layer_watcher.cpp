@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "layer_watcher.h"
+#include "util.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QStringList>
+
+#include <cassert>
+#include <chrono>
+
+// Layer installers write several files in a row, wait for the directories to settle before scanning them
+static const int SCAN_DELAY_MS = 500;
+static const int LOAD_POLL_MS = 20;
+
+static std::string GetCleanPath(const QString& path) { return QDir::cleanPath(QFileInfo(path).absoluteFilePath()).toStdString(); }
+
+// Runs on a worker thread, the manifests errors are collected to be reported by Apply on the main thread
+LayerWatcher::LoadedManifests LayerWatcher::LoadManifests(const std::vector<std::string>& manifest_paths, LayerLoadMode mode) {
+    LoadedManifests loaded;
+
+    for (std::size_t i = 0, n = manifest_paths.size(); i < n; ++i) {
+        Layer layer;
+        std::string error;
+        const bool result = LayerManager::LoadManifest(layer, manifest_paths[i], mode, &error);
+        if (!error.empty()) {
+            LayerManifestError manifest_error;
+            manifest_error.manifest_path = manifest_paths[i];
+            manifest_error.message = error;
+            loaded.errors.push_back(manifest_error);
+        }
+        if (!result) continue;
+
+        loaded.layers.push_back(std::move(layer));
+    }
+
+    return loaded;
+}
+
+LayerWatcher::LayerWatcher(LayerManager& layers, LayerLoadMode mode) : layers(layers), mode(mode) {
+    this->scan_timer.setSingleShot(true);
+    this->scan_timer.setInterval(SCAN_DELAY_MS);
+    this->load_timer.setInterval(LOAD_POLL_MS);
+
+    this->connect(&this->watcher, SIGNAL(directoryChanged(const QString&)), this, SLOT(OnPathChanged(const QString&)));
+    this->connect(&this->watcher, SIGNAL(fileChanged(const QString&)), this, SLOT(OnPathChanged(const QString&)));
+    this->connect(&this->scan_timer, SIGNAL(timeout()), this, SLOT(OnScan()));
+    this->connect(&this->load_timer, SIGNAL(timeout()), this, SLOT(OnLoadPoll()));
+
+    this->Reset();
+}
+
+LayerWatcher::~LayerWatcher() {
+    // Don't leave the worker thread running on a destroyed LayerWatcher
+    if (this->loading.valid()) this->loading.wait();
+}
+
+void LayerWatcher::Reset() {
+    this->scan_timer.stop();
+    this->load_timer.stop();
+    if (this->loading.valid()) this->loading.get();
+
+    this->directories.clear();
+    this->errors.clear();
+    this->removed_manifests.clear();
+    this->pending_paths.clear();
+
+    // The layers are already loaded, only take a snapshot of the manifests
+    const QStringList& parent_paths = this->WatchDirectories();
+
+    std::vector<std::string> updated_manifests;
+    for (std::size_t i = 0, n = this->pending_paths.size(); i < n; ++i) {
+        this->ScanDirectory(this->pending_paths[i], updated_manifests);
+    }
+    this->pending_paths.clear();
+
+    this->UpdateWatchedPaths(parent_paths);
+}
+
+bool LayerWatcher::HasPendingChanges() const {
+    return this->scan_timer.isActive() || this->loading.valid() || !this->removed_manifests.empty();
+}
+
+bool LayerWatcher::HasLoadedChanges() const {
+    if (!this->loading.valid()) return !this->removed_manifests.empty();
+
+    return this->loading.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+std::vector<std::string> LayerWatcher::Apply(bool wait) {
+    std::vector<std::string> updated_layers;
+    this->errors.clear();
+
+    // The removed manifests are merged with the loaded manifests, an updated manifest is both removed and loaded
+    if (!wait) {
+        if (this->HasLoadedChanges()) this->MergeLoadedLayers(updated_layers);
+        return updated_layers;
+    }
+
+    // The manifests being loaded are older than the changes waiting for the scan, they are merged first
+    if (this->loading.valid()) {
+        this->MergeLoadedLayers(updated_layers);
+    }
+
+    if (this->scan_timer.isActive()) {
+        this->scan_timer.stop();
+        this->OnScan();
+    }
+
+    this->MergeLoadedLayers(updated_layers);
+
+    return updated_layers;
+}
+
+void LayerWatcher::OnPathChanged(const QString& path) {
+    const std::string& changed_path = GetCleanPath(path);
+    if (!IsStringFound(this->pending_paths, changed_path)) this->pending_paths.push_back(changed_path);
+
+    this->scan_timer.start();
+}
+
+void LayerWatcher::OnScan() {
+    // The loaded manifests are waiting to be applied, scan again once they are
+    if (this->loading.valid()) {
+        this->scan_timer.start();
+        return;
+    }
+
+    // A search path directory may have been created or deleted
+    const QStringList& parent_paths = this->WatchDirectories();
+
+    std::vector<std::string> scanned_directories;
+    std::vector<std::string> updated_manifests;
+    for (std::size_t i = 0, n = this->pending_paths.size(); i < n; ++i) {
+        std::string directory = this->pending_paths[i];
+        if (this->directories.find(directory) == this->directories.end()) {
+            directory = GetCleanPath(QFileInfo(directory.c_str()).absolutePath());
+            if (this->directories.find(directory) == this->directories.end()) continue;  // Parent of a missing search path
+        }
+
+        if (IsStringFound(scanned_directories, directory)) continue;
+        scanned_directories.push_back(directory);
+
+        this->ScanDirectory(directory, updated_manifests);
+    }
+    this->pending_paths.clear();
+
+    this->UpdateWatchedPaths(parent_paths);
+
+    if (updated_manifests.empty() && this->removed_manifests.empty()) return;
+
+    this->loading = std::async(std::launch::async, LoadManifests, updated_manifests, this->mode);
+    this->load_timer.start();
+}
+
+void LayerWatcher::OnLoadPoll() {
+    assert(this->loading.valid());
+
+    if (this->loading.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return;
+
+    this->load_timer.stop();
+
+    emit LayersChanged();
+}
+
+QStringList LayerWatcher::WatchDirectories() {
+    const std::vector<std::string>& search_paths = this->layers.GetSearchPaths();
+
+    std::vector<std::string> search_directories;
+    QStringList parent_paths;
+
+    for (std::size_t i = 0, n = search_paths.size(); i < n; ++i) {
+        // Layers found in the Windows registry are not watched
+        if (QString(search_paths[i].c_str()).startsWith("HKEY_")) continue;
+
+        const std::string& directory = GetCleanPath(search_paths[i].c_str());
+        if (QFileInfo(directory.c_str()).isDir()) {
+            search_directories.push_back(directory);
+
+            // A directory found for the first time is scanned so that all its manifests are loaded
+            if (this->directories.find(directory) == this->directories.end()) {
+                this->directories.insert(std::make_pair(directory, Manifests()));
+                this->pending_paths.push_back(directory);
+            }
+        } else {
+            // Watch the closest existing parent directory to notice when the search path directory is created
+            QString parent_path = directory.c_str();
+            do {
+                parent_path = QFileInfo(parent_path).absolutePath();
+            } while (!QFileInfo(parent_path).isDir() && !QDir(parent_path).isRoot());
+            parent_paths.append(parent_path);
+        }
+    }
+
+    // The manifests of deleted directories are removed
+    for (auto it = this->directories.begin(); it != this->directories.end();) {
+        if (IsStringFound(search_directories, it->first)) {
+            ++it;
+            continue;
+        }
+
+        for (auto manifest = it->second.begin(), end = it->second.end(); manifest != end; ++manifest) {
+            this->removed_manifests.push_back(manifest->first);
+        }
+        it = this->directories.erase(it);
+    }
+
+    return parent_paths;
+}
+
+void LayerWatcher::ScanDirectory(const std::string& directory, std::vector<std::string>& updated_manifests) {
+    Manifests& manifests = this->directories[directory];
+
+    Manifests scanned_manifests;
+    const QFileInfoList& file_info_list = QDir(directory.c_str()).entryInfoList(QStringList() << "*.json", QDir::Files);
+    for (int i = 0, n = file_info_list.size(); i < n; ++i) {
+        const std::string& manifest_path = GetCleanPath(file_info_list[i].absoluteFilePath());
+        const qint64 modified = file_info_list[i].lastModified().toMSecsSinceEpoch();
+        scanned_manifests.insert(std::make_pair(manifest_path, modified));
+
+        auto it = manifests.find(manifest_path);
+        if (it == manifests.end()) {
+            updated_manifests.push_back(manifest_path);
+        } else if (it->second != modified) {
+            // An updated manifest is removed and loaded again
+            this->removed_manifests.push_back(manifest_path);
+            updated_manifests.push_back(manifest_path);
+        }
+    }
+
+    for (auto it = manifests.begin(), end = manifests.end(); it != end; ++it) {
+        if (scanned_manifests.find(it->first) == scanned_manifests.end()) this->removed_manifests.push_back(it->first);
+    }
+
+    manifests.swap(scanned_manifests);
+}
+
+void LayerWatcher::MergeLoadedLayers(std::vector<std::string>& updated_layers) {
+    std::vector<Layer> loaded_layers;
+    if (this->loading.valid()) {
+        this->load_timer.stop();
+        LoadedManifests loaded = this->loading.get();
+        loaded_layers.swap(loaded.layers);
+        this->errors.insert(this->errors.end(), loaded.errors.begin(), loaded.errors.end());
+    }
+
+    std::vector<std::string> removed;
+    removed.swap(this->removed_manifests);
+
+    const std::vector<std::string>& layer_keys = this->layers.UpdateLayerManifests(loaded_layers, removed);
+    for (std::size_t i = 0, n = layer_keys.size(); i < n; ++i) {
+        if (!IsStringFound(updated_layers, layer_keys[i])) updated_layers.push_back(layer_keys[i]);
+    }
+}
+
+void LayerWatcher::UpdateWatchedPaths(const QStringList& parent_paths) {
+    QStringList paths = parent_paths;
+    for (auto it = this->directories.begin(), end = this->directories.end(); it != end; ++it) {
+        paths.append(it->first.c_str());
+
+        // A manifest edited in place doesn't notify its directory
+        for (auto manifest = it->second.begin(), manifest_end = it->second.end(); manifest != manifest_end; ++manifest) {
+            paths.append(manifest->first.c_str());
+        }
+    }
+    paths.removeDuplicates();
+
+    QStringList watched_paths = this->watcher.directories() + this->watcher.files();
+
+    QStringList unwatched_paths;
+    for (int i = 0, n = watched_paths.size(); i < n; ++i) {
+        if (!paths.contains(watched_paths[i])) unwatched_paths.append(watched_paths[i]);
+    }
+    if (!unwatched_paths.isEmpty()) this->watcher.removePaths(unwatched_paths);
+
+    QStringList new_paths;
+    for (int i = 0, n = paths.size(); i < n; ++i) {
+        if (!watched_paths.contains(paths[i])) new_paths.append(paths[i]);
+    }
+    if (!new_paths.isEmpty()) this->watcher.addPaths(new_paths);
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#pragma once
+
+#include "layer_manager.h"
+
+#include <QObject>
+#include <QFileSystemWatcher>
+#include <QTimer>
+#include <QStringList>
+
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+
+struct LayerManifestError {
+    std::string manifest_path;
+    std::string message;
+};
+
+// Watch the layers search paths and keep the layers of a LayerManager in sync with the installed manifests without rescanning all
+// the search paths. Only the directories that changed are listed again, the added or updated manifests are loaded on a worker
+// thread and LayersChanged is emitted when they are ready to be applied.
+class LayerWatcher : public QObject {
+    Q_OBJECT
+
+   public:
+    LayerWatcher(LayerManager& layers, LayerLoadMode mode = LAYER_LOAD_FULL);
+    ~LayerWatcher();
+
+    // Watch the current search paths again, after the layers were reloaded or the search paths changed
+    void Reset();
+
+    bool HasPendingChanges() const;
+
+    // The manifests loaded on the worker thread are ready to be merged without waiting
+    bool HasLoadedChanges() const;
+
+    // Merge the loaded manifests in the LayerManager, return the keys of the layers added, replaced or removed. With 'wait', the
+    // pending directories changes are scanned and their manifests loaded first. Without, only the manifests already loaded are
+    // merged and the other changes are notified by a later LayersChanged, the GUI thread doesn't wait for the worker thread.
+    std::vector<std::string> Apply(bool wait = true);
+
+    // The manifests loaded on the worker thread don't show alerts, their errors are reported here by the last Apply
+    const std::vector<LayerManifestError>& GetErrors() const { return this->errors; }
+
+   Q_SIGNALS:
+    void LayersChanged();
+
+   public Q_SLOTS:
+    void OnPathChanged(const QString& path);
+    void OnScan();
+    void OnLoadPoll();
+
+   private:
+    LayerWatcher(const LayerWatcher&) = delete;
+    LayerWatcher& operator=(const LayerWatcher&) = delete;
+
+    typedef std::map<std::string, qint64> Manifests;  // Manifest path and last modification time
+
+    struct LoadedManifests {
+        std::vector<Layer> layers;
+        std::vector<LayerManifestError> errors;
+    };
+
+    static LoadedManifests LoadManifests(const std::vector<std::string>& manifest_paths, LayerLoadMode mode);
+
+    QStringList WatchDirectories();
+    void ScanDirectory(const std::string& directory, std::vector<std::string>& updated_manifests);
+    void UpdateWatchedPaths(const QStringList& parent_paths);
+    void MergeLoadedLayers(std::vector<std::string>& updated_layers);
+
+    LayerManager& layers;
+    const LayerLoadMode mode;
+    QFileSystemWatcher watcher;
+    QTimer scan_timer;
+    QTimer load_timer;
+    std::map<std::string, Manifests> directories;
+    std::vector<std::string> pending_paths;
+    std::vector<std::string> removed_manifests;
+    std::vector<LayerManifestError> errors;
+    std::future<LoadedManifests> loading;
+};
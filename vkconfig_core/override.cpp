@@ -28,12 +28,33 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QSaveFile>
 #include <QTextStream>
 
 #include <vulkan/vulkan.h>
 
 #include <cstdio>
 
+// Write an override file only when its content changed so that running Vulkan applications don't reload identical settings.
+// The content is written to a temporary file renamed over the previous file so that the Vulkan loader never reads a partial file.
+bool WriteOverrideFile(const std::string& path, const QByteArray& content) {
+    QFile current_file(path.c_str());
+    if (current_file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        const bool unchanged = current_file.readAll() == content;
+        current_file.close();
+
+        if (unchanged) return true;
+    }
+
+    QSaveFile file(path.c_str());
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return false;
+    }
+
+    file.write(content);
+    return file.commit();
+}
+
 // Create and write VkLayer_override.json file
 bool WriteLayersOverride(const Environment& environment, const std::vector<Layer>& available_layers,
                          const Configuration& configuration, const std::string& layers_path) {
@@ -44,6 +65,8 @@ bool WriteLayersOverride(const Environment& environment, const std::vector<Layer
     const QStringList& path_env_set = ConvertString(environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_ENV_SET));
     const QStringList& path_env_add = ConvertString(environment.GetUserDefinedLayersPaths(USER_DEFINED_LAYERS_PATHS_ENV_ADD));
 
+    const KeyIndex<Layer> layer_index(available_layers);
+
     QStringList layer_system_paths;
 
     QStringList layer_override_paths;
@@ -55,7 +78,7 @@ bool WriteLayersOverride(const Environment& environment, const std::vector<Layer
 
         if (parameter.state != LAYER_STATE_OVERRIDDEN) continue;
 
-        const Layer* layer = FindByKey(available_layers, parameter.key.c_str());
+        const Layer* layer = layer_index.Find(available_layers, parameter.key.c_str());
         if (layer == nullptr) {
             continue;
         }
@@ -110,7 +133,7 @@ bool WriteLayersOverride(const Environment& environment, const std::vector<Layer
     }
 
     QJsonObject disable;
-    disable.insert("DISABLE_VK_LAYER_LUNARG_override", "1");
+    disable.insert(GetDisableOverrideVariable(), "1");
 
     QJsonObject layer;
     layer.insert("name", "VK_LAYER_LUNARG_override");
@@ -131,9 +154,9 @@ bool WriteLayersOverride(const Environment& environment, const std::vector<Layer
         for (std::size_t i = 0, n = applications.size(); i < n; ++i) {
             if (!applications[i].override_layers) continue;
 
+            // The missing applications may not be removed yet by Environment::SyncApplications, they just match no application
             const std::string& executable_path(
                 ConvertNativeSeparators(QFileInfo(applications[i].executable_path.c_str()).absoluteFilePath().toStdString()));
-            assert(QFileInfo(executable_path.c_str()).exists());
             json_applist.append(executable_path.c_str());
         }
 
@@ -145,11 +168,8 @@ bool WriteLayersOverride(const Environment& environment, const std::vector<Layer
     root.insert("layer", layer);
     QJsonDocument doc(root);
 
-    QFile json_file(layers_path.c_str());
-    const bool result_layers_file = json_file.open(QIODevice::WriteOnly | QIODevice::Text);
+    const bool result_layers_file = WriteOverrideFile(layers_path, doc.toJson());
     assert(result_layers_file);
-    json_file.write(doc.toJson());
-    json_file.close();
 
     return result_layers_file;
 }
@@ -161,16 +181,14 @@ bool WriteSettingsOverride(const std::vector<Layer>& available_layers, const Con
         fprintf(stderr, "Cannot open file %s\n", settings_path.c_str());
         exit(1);
     };
-    QFile file(settings_path.c_str());
-    const bool result_settings_file = file.open(QIODevice::WriteOnly | QIODevice::Text);
-    if (!result_settings_file) {
-        fprintf(stderr, "Cannot open file %s\n", settings_path.c_str());
-        exit(1);
-    }
-    QTextStream stream(&file);
+
+    QString text;
+    QTextStream stream(&text);
 
     bool has_missing_layers = false;
 
+    const KeyIndex<Layer> layer_index(available_layers);
+
     // Loop through all the layers
     for (std::size_t j = 0, n = configuration.parameters.size(); j < n; ++j) {
         const Parameter& parameter = configuration.parameters[j];
@@ -178,7 +196,7 @@ bool WriteSettingsOverride(const std::vector<Layer>& available_layers, const Con
             continue;
         }
 
-        const Layer* layer = FindByKey(available_layers, parameter.key.c_str());
+        const Layer* layer = layer_index.Find(available_layers, parameter.key.c_str());
         if (layer == nullptr) {
             has_missing_layers = true;
             continue;
@@ -200,7 +218,7 @@ bool WriteSettingsOverride(const std::vector<Layer>& available_layers, const Con
             }
 
             // Skip missing settings
-            const SettingMeta* meta = FindSetting(layer->settings, setting_data->key.c_str());
+            const SettingMeta* meta = layer->FindSettingMeta(setting_data->key);
             if (meta == nullptr) {
                 continue;
             }
@@ -248,7 +266,13 @@ bool WriteSettingsOverride(const std::vector<Layer>& available_layers, const Con
             stream << "\n\n";
         }
     }
-    file.close();
+    stream.flush();
+
+    const bool result_settings_file = WriteOverrideFile(settings_path, text.toUtf8());
+    if (!result_settings_file) {
+        fprintf(stderr, "Cannot open file %s\n", settings_path.c_str());
+        exit(1);
+    }
 
     return result_settings_file && !has_missing_layers;
 }
@@ -258,8 +282,7 @@ bool OverrideConfiguration(const Environment& environment, const std::vector<Lay
     const std::string layers_path = GetPath(BUILTIN_PATH_OVERRIDE_LAYERS);
     const std::string settings_path = GetPath(BUILTIN_PATH_OVERRIDE_SETTINGS);
 
-    // Clean up
-    SurrenderConfiguration(environment);
+    // The override files are replaced in place and only when their content changed, so no clean up before writing them
 
     // VkLayer_override.json
     const bool result_layers = WriteLayersOverride(environment, available_layers, configuration, layers_path);
@@ -295,6 +318,8 @@ bool SurrenderConfiguration(const Environment& environment) {
     return result_layers && result_settings;
 }
 
+const char* GetDisableOverrideVariable() { return "DISABLE_VK_LAYER_LUNARG_override"; }
+
 bool HasOverride() {
     const std::string layers_path = GetPath(BUILTIN_PATH_OVERRIDE_LAYERS);
     const std::string settings_path = GetPath(BUILTIN_PATH_OVERRIDE_SETTINGS);
@@ -24,6 +24,8 @@
 #include "environment.h"
 #include "application.h"
 
+#include <QByteArray>
+
 // Create the VkLayer_override.json and vk_layer_settings.txt files to take over Vulkan layers from Vulkan applications
 bool OverrideConfiguration(const Environment& environment, const std::vector<Layer>& available_layers,
                            const Configuration& configuration);
@@ -34,6 +36,16 @@ bool SurrenderConfiguration(const Environment& environment);
 // Check whether a layers configuration is activated
 bool HasOverride();
 
+// Environment variable which disables the layers override in the processes where it is set to "1"
+const char* GetDisableOverrideVariable();
+
+// Write an override file, the file is left untouched when the content is unchanged
+bool WriteOverrideFile(const std::string& path, const QByteArray& content);
+
+// Write the layers file for override layer
+bool WriteLayersOverride(const Environment& environment, const std::vector<Layer>& available_layers,
+                         const Configuration& configuration, const std::string& layers_path);
+
 // Write the settings file for override layer
 bool WriteSettingsOverride(const std::vector<Layer>& available_layers,
                            const Configuration& configuration, const std::string& settings_path);
@@ -50,10 +50,7 @@ bool Parameter::ApplyPresetSettings(const LayerPreset& preset) {
     return true;
 }
 
-ParameterRank GetParameterOrdering(const std::vector<Layer>& available_layers, const Parameter& parameter) {
-    assert(!parameter.key.empty());
-
-    const Layer* layer = FindByKey(available_layers, parameter.key.c_str());
+static ParameterRank GetParameterOrdering(const Layer* layer, const Parameter& parameter) {
     if (layer == nullptr) {
         return PARAMETER_RANK_MISSING;
     } else if (parameter.state == LAYER_STATE_EXCLUDED) {
@@ -72,17 +69,25 @@ ParameterRank GetParameterOrdering(const std::vector<Layer>& available_layers, c
     }
 }
 
+ParameterRank GetParameterOrdering(const std::vector<Layer>& available_layers, const Parameter& parameter) {
+    assert(!parameter.key.empty());
+
+    return GetParameterOrdering(FindByKey(available_layers, parameter.key.c_str()), parameter);
+}
+
 Version ComputeMinApiVersion(const Version api_version, const std::vector<Parameter>& parameters,
                              const std::vector<Layer>& layers) {
     if (parameters.empty()) return Version::VERSION_NULL;
 
     Version min_version = api_version;
 
+    const KeyIndex<Layer> layer_index(layers);
+
     for (std::size_t i = 0, n = parameters.size(); i < n; ++i) {
-        const Layer* layer = FindByKey(layers, parameters[i].key.c_str());
+        const Layer* layer = layer_index.Find(layers, parameters[i].key.c_str());
         if (layer == nullptr) continue;
 
-        const ParameterRank state = GetParameterOrdering(layers, parameters[i]);
+        const ParameterRank state = GetParameterOrdering(layer, parameters[i]);
 
         if (state == PARAMETER_RANK_EXCLUDED) continue;
         if (state == PARAMETER_RANK_MISSING) continue;
@@ -95,11 +100,12 @@ Version ComputeMinApiVersion(const Version api_version, const std::vector<Parame
 
 void OrderParameter(std::vector<Parameter>& parameters, const std::vector<Layer>& layers) {
     struct ParameterCompare {
-        ParameterCompare(const std::vector<Layer>& layers) : layers(layers) {}
+        ParameterCompare(const std::vector<Layer>& layers, const KeyIndex<Layer>& layer_index)
+            : layers(layers), layer_index(layer_index) {}
 
         bool operator()(const Parameter& a, const Parameter& b) const {
-            const ParameterRank rankA = GetParameterOrdering(layers, a);
-            const ParameterRank rankB = GetParameterOrdering(layers, b);
+            const ParameterRank rankA = GetParameterOrdering(layer_index.Find(layers, a.key.c_str()), a);
+            const ParameterRank rankB = GetParameterOrdering(layer_index.Find(layers, b.key.c_str()), b);
             if (rankA == rankB && a.state == LAYER_STATE_OVERRIDDEN) {
                 if (a.overridden_rank != Parameter::NO_RANK && b.overridden_rank != Parameter::NO_RANK)
                     return a.overridden_rank < b.overridden_rank;
@@ -120,9 +126,12 @@ void OrderParameter(std::vector<Parameter>& parameters, const std::vector<Layer>
         }
 
         const std::vector<Layer>& layers;
+        const KeyIndex<Layer>& layer_index;
     };
 
-    std::sort(parameters.begin(), parameters.end(), ParameterCompare(layers));
+    const KeyIndex<Layer> layer_index(layers);
+
+    std::sort(parameters.begin(), parameters.end(), ParameterCompare(layers, layer_index));
 
     for (std::size_t i = 0, n = parameters.size(); i < n; ++i) {
         if (parameters[i].state == LAYER_STATE_OVERRIDDEN)
@@ -145,6 +154,8 @@ void FilterParameters(std::vector<Parameter>& parameters, const LayerState state
 }
 
 bool HasMissingLayer(const std::vector<Parameter>& parameters, const std::vector<Layer>& layers, std::string& missing_layer) {
+    const KeyIndex<Layer> layer_index(layers);
+
     for (auto it = parameters.begin(), end = parameters.end(); it != end; ++it) {
         if (it->state == LAYER_STATE_EXCLUDED) {
             continue;  // If excluded are missing, it doesn't matter
@@ -154,7 +165,7 @@ bool HasMissingLayer(const std::vector<Parameter>& parameters, const std::vector
             continue;  // If unsupported are missing, it doesn't matter
         }
 
-        if (!IsFound(layers, it->key.c_str())) {
+        if (!layer_index.IsFound(it->key.c_str())) {
             missing_layer = it->key;
             return true;
         }
@@ -180,14 +191,15 @@ std::size_t CountOverriddenLayers(const std::vector<Parameter>& parameters) {
 std::size_t CountExcludedLayers(const std::vector<Parameter>& parameters, const std::vector<Layer>& layers) {
     std::size_t count = 0;
 
+    const KeyIndex<Layer> layer_index(layers);
+
     for (std::size_t i = 0, n = parameters.size(); i < n; ++i) {
         const Parameter& parameter = parameters[i];
         if (!IsPlatformSupported(parameter.platform_flags)) continue;
 
         if (parameter.state != LAYER_STATE_EXCLUDED) continue;
 
-        const Layer* layer = FindByKey(layers, parameter.key.c_str());
-        if (layer == nullptr) continue;  // Do not display missing excluded layers
+        if (!layer_index.IsFound(parameter.key.c_str())) continue;  // Do not display missing excluded layers
 
         ++count;
     }
@@ -197,6 +209,7 @@ std::size_t CountExcludedLayers(const std::vector<Parameter>& parameters, const
 
 std::vector<Parameter> GatherParameters(const std::vector<Parameter>& parameters, const std::vector<Layer>& available_layers) {
     std::vector<Parameter> gathered_parameters;
+    gathered_parameters.reserve(parameters.size() + available_layers.size());
 
     // Loop through the layers. They are expected to be in order
     for (std::size_t i = 0, n = parameters.size(); i < n; ++i) {
@@ -206,16 +219,19 @@ std::vector<Parameter> GatherParameters(const std::vector<Parameter>& parameters
         gathered_parameters.push_back(parameter);
     }
 
+    const KeyIndex<Parameter> parameter_index(parameters);
+
     for (std::size_t i = 0, n = available_layers.size(); i < n; ++i) {
         const Layer& layer = available_layers[i];
 
         // The layer is already in the layer tree
-        if (IsFound(parameters, layer.key.c_str())) continue;
+        if (parameter_index.IsFound(layer.key.c_str())) continue;
 
         Parameter parameter;
         parameter.key = layer.key;
         parameter.state = LAYER_STATE_APPLICATION_CONTROLLED;
         CollectDefaultSettingData(layer.settings, parameter.settings);
+        parameter.settings_memory = layer.GetSettingsMemory();
 
         gathered_parameters.push_back(parameter);
     }
@@ -24,6 +24,7 @@
 #include "layer_state.h"
 #include "setting.h"
 
+#include <memory>
 #include <vector>
 
 enum ParameterRank {
@@ -49,6 +50,10 @@ struct Parameter {
     int platform_flags;
     SettingDataSet settings;
     int overridden_rank;
+
+    // The settings data are owned by the layer settings metadata they were instantiated from, the parameter keeps the metadata
+    // alive so that the settings remain valid after the layers are reloaded and until they are instantiated again
+    std::shared_ptr<const LayerSettingsMemory> settings_memory;
 };
 
 ParameterRank GetParameterOrdering(const std::vector<Layer>& available_layers, const Parameter& parameter);
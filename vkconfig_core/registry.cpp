@@ -105,7 +105,7 @@ static void LoadDeviceRegistry(DEVINST id, const QString &entry, std::vector<Lay
         for (wchar_t *curr_filename = path; curr_filename[0] != '\0'; curr_filename += wcslen(curr_filename) + 1) {
             Layer layer;
             if (layer.Load(layers, QString::fromWCharArray(curr_filename).toStdString(), type)) {
-                layers.push_back(layer);
+                layers.push_back(std::move(layer));
             }
 
             if (data_type == REG_SZ) {
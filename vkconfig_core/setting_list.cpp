@@ -26,6 +26,10 @@
 #include <QJsonArray>
 #include <QJsonDocument>
 
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+
 static QString ReadAll(const std::string& path) {
     QString json_text;
 
@@ -105,6 +109,15 @@ SettingData* SettingMetaList::Instantiate() {
     return setting_data;
 }
 
+int SettingMetaList::FindValueIndex(const NumberOrString& value) const {
+    assert(std::is_sorted(this->list.begin(), this->list.end()));
+
+    const auto it = std::lower_bound(this->list.begin(), this->list.end(), value);
+    if (it == this->list.end() || *it != value) return -1;
+
+    return static_cast<int>(std::distance(this->list.begin(), it));
+}
+
 bool SettingMetaList::Load(const QJsonObject& json_setting) {
     if (json_setting.value("list") != QJsonValue::Undefined) {
         const QJsonArray& json_list_array = ReadArray(json_setting, "list");
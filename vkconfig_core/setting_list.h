@@ -29,7 +29,10 @@ struct SettingMetaList : public SettingMeta {
     bool Load(const QJsonObject& json_setting) override;
     std::string Export(ExportMode export_mode) const override;
 
-    std::vector<NumberOrString> list;
+    // Binary search in the sorted list of accepted values, return -1 when the value isn't listed
+    int FindValueIndex(const NumberOrString& value) const;
+
+    std::vector<NumberOrString> list;  // Sorted when loaded
     std::vector<EnabledNumberOrString> default_value;
     bool list_only;
 
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "../layer_manager.h"
+#include "../configuration.h"
+#include "../environment.h"
+#include "../override.h"
+#include "../doc.h"
+
+#include <gtest/gtest.h>
+
+#include <QFile>
+#include <QDir>
+#include <QTemporaryDir>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Synthetic workload: sized after a large SDK install with many user-defined layers
+static const int BENCHMARK_LAYER_COUNT = 200;
+static const int BENCHMARK_SETTING_COUNT = 40;  // Per layer
+static const int BENCHMARK_CONFIGURATION_COUNT = 50;
+static const int BENCHMARK_CONFIGURATION_LAYER_COUNT = 20;  // Layers referenced by each configuration
+
+static std::string GetLayerName(int layer_index) { return format("VK_LAYER_BENCHMARK_layer_%03d", layer_index); }
+
+static QJsonObject MakeSetting(int setting_index) {
+    QJsonObject json_setting;
+    json_setting.insert("key", format("setting_%03d", setting_index).c_str());
+    json_setting.insert("label", format("Setting %d", setting_index).c_str());
+    json_setting.insert("description", format("Benchmark setting %d description", setting_index).c_str());
+
+    switch (setting_index % 5) {
+        default:
+        case 0:
+            json_setting.insert("type", "BOOL");
+            json_setting.insert("default", true);
+            break;
+        case 1:
+            json_setting.insert("type", "INT");
+            json_setting.insert("default", setting_index);
+            break;
+        case 2:
+            json_setting.insert("type", "STRING");
+            json_setting.insert("default", format("value_%d", setting_index).c_str());
+            break;
+        case 3:
+        case 4: {
+            QJsonArray json_flags;
+            for (int flag_index = 0; flag_index < 4; ++flag_index) {
+                QJsonObject json_flag;
+                json_flag.insert("key", format("flag%d", flag_index).c_str());
+                json_flag.insert("label", format("Flag %d", flag_index).c_str());
+                json_flag.insert("description", format("Benchmark flag %d description", flag_index).c_str());
+                json_flags.append(json_flag);
+            }
+            json_setting.insert("flags", json_flags);
+
+            if (setting_index % 5 == 3) {
+                json_setting.insert("type", "ENUM");
+                json_setting.insert("default", "flag1");
+            } else {
+                QJsonArray json_default;
+                json_default.append("flag0");
+                json_default.append("flag2");
+                json_setting.insert("type", "FLAGS");
+                json_setting.insert("default", json_default);
+            }
+            break;
+        }
+    }
+
+    return json_setting;
+}
+
+static bool WriteLayerManifest(const std::string& path, int layer_index) {
+    QJsonArray json_settings;
+    for (int setting_index = 0; setting_index < BENCHMARK_SETTING_COUNT; ++setting_index) {
+        json_settings.append(MakeSetting(setting_index));
+    }
+
+    QJsonObject json_features;
+    json_features.insert("settings", json_settings);
+
+    QJsonObject json_layer;
+    json_layer.insert("name", GetLayerName(layer_index).c_str());
+    json_layer.insert("library_path", "./libVkLayer_benchmark.so");
+    json_layer.insert("api_version", "1.2.170");
+    json_layer.insert("implementation_version", "1");
+    json_layer.insert("description", "Synthetic benchmark layer");
+    json_layer.insert("features", json_features);
+
+    QJsonObject json_root;
+    json_root.insert("file_format_version", "1.2.0");
+    json_root.insert("layer", json_layer);
+
+    QFile file(path.c_str());
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) return false;
+    file.write(QJsonDocument(json_root).toJson());
+    file.close();
+    return true;
+}
+
+static Configuration MakeConfiguration(const std::vector<Layer>& available_layers, int configuration_index) {
+    Configuration configuration;
+    configuration.key = format("Benchmark configuration %03d", configuration_index);
+    configuration.description = "Synthetic benchmark configuration";
+
+    for (int i = 0; i < BENCHMARK_CONFIGURATION_LAYER_COUNT; ++i) {
+        const Layer& layer = available_layers[(configuration_index + i * 7) % available_layers.size()];
+
+        Parameter parameter;
+        parameter.key = layer.key;
+        parameter.state = (i % 4 == 3) ? LAYER_STATE_EXCLUDED : LAYER_STATE_OVERRIDDEN;
+        parameter.overridden_rank = i;
+        CollectDefaultSettingData(layer.settings, parameter.settings);
+
+        configuration.parameters.push_back(parameter);
+    }
+
+    return configuration;
+}
+
+static void Report(const char* name, const QElapsedTimer& timer, int iterations) {
+    const qint64 elapsed = timer.elapsed();
+    std::printf("[ BENCHMARK] %-24s %6d iteration(s) %8lld ms total %10.3f ms per iteration\n", name, iterations,
+                static_cast<long long>(elapsed), static_cast<double>(elapsed) / iterations);
+
+    ::testing::Test::RecordProperty(name, static_cast<int>(elapsed));
+}
+
+class benchmark_layers : public ::testing::Test {
+   protected:
+    static void SetUpTestCase() {
+        temp_dir = new QTemporaryDir;
+        ASSERT_TRUE(temp_dir->isValid());
+
+        QDir dir(temp_dir->path());
+        dir.mkpath("layers");
+        dir.mkpath("configurations");
+        dir.mkpath("doc");
+
+        for (int layer_index = 0; layer_index < BENCHMARK_LAYER_COUNT; ++layer_index) {
+            const std::string path = GetLayersPath() + "/" + GetLayerName(layer_index) + ".json";
+            ASSERT_TRUE(WriteLayerManifest(path, layer_index));
+        }
+    }
+
+    static void TearDownTestCase() {
+        delete temp_dir;
+        temp_dir = nullptr;
+    }
+
+    static std::string GetPath(const char* sub_dir) { return (temp_dir->path() + "/" + sub_dir).toStdString(); }
+    static std::string GetLayersPath() { return GetPath("layers"); }
+
+    static QTemporaryDir* temp_dir;
+};
+
+QTemporaryDir* benchmark_layers::temp_dir = nullptr;
+
+TEST_F(benchmark_layers, load_layers_from_path) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layer_manager(environment);
+
+    QElapsedTimer timer;
+    timer.start();
+    layer_manager.LoadLayersFromPath(GetLayersPath());
+    Report("LoadLayersFromPath", timer, 1);
+
+    EXPECT_EQ(BENCHMARK_LAYER_COUNT, layer_manager.GetLayers().size());
+    EXPECT_EQ(BENCHMARK_SETTING_COUNT, CountSettings(layer_manager.GetLayers()[0].settings));
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+// Only the generated layers are loaded so that the timings don't depend on the layers installed on the machine
+TEST_F(benchmark_layers, load_layers_header_only) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layer_manager(environment);
+
+    QElapsedTimer timer;
+    timer.start();
+    layer_manager.LoadLayersFromPath(GetLayersPath(), LAYER_LOAD_HEADER);
+    Report("LoadLayersHeaderOnly", timer, 1);
+
+    EXPECT_EQ(BENCHMARK_LAYER_COUNT, layer_manager.GetLayers().size());
+    EXPECT_TRUE(layer_manager.FindLayer(GetLayerName(BENCHMARK_LAYER_COUNT - 1)) != nullptr);
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST_F(benchmark_layers, load_configurations) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadLayersFromPath(GetLayersPath());
+    ASSERT_EQ(BENCHMARK_LAYER_COUNT, layer_manager.GetLayers().size());
+
+    std::vector<std::string> configuration_paths;
+    for (int i = 0; i < BENCHMARK_CONFIGURATION_COUNT; ++i) {
+        const Configuration& configuration = MakeConfiguration(layer_manager.GetLayers(), i);
+        configuration_paths.push_back(GetPath("configurations") + "/" + configuration.key + ".json");
+        ASSERT_TRUE(configuration.Save(layer_manager.GetLayers(), configuration_paths.back()));
+    }
+
+    std::vector<Configuration> configurations;
+
+    // Same work as ConfigurationManager::LoadConfigurationsPath without touching the user configuration directory
+    QElapsedTimer timer;
+    timer.start();
+    for (std::size_t i = 0, n = configuration_paths.size(); i < n; ++i) {
+        Configuration configuration;
+        if (configuration.Load(layer_manager.GetLayers(), configuration_paths[i])) {
+            configurations.push_back(configuration);
+        }
+    }
+    Report("LoadConfigurations", timer, BENCHMARK_CONFIGURATION_COUNT);
+
+    EXPECT_EQ(BENCHMARK_CONFIGURATION_COUNT, configurations.size());
+    EXPECT_EQ(BENCHMARK_CONFIGURATION_LAYER_COUNT, configurations[0].parameters.size());
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST_F(benchmark_layers, write_override) {
+    static const int ITERATIONS = 20;
+
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadLayersFromPath(GetLayersPath());
+    ASSERT_EQ(BENCHMARK_LAYER_COUNT, layer_manager.GetLayers().size());
+
+    const std::string layers_path = GetPath("VkLayer_override.json");
+    const std::string settings_path = GetPath("vk_layer_settings.txt");
+
+    std::vector<Configuration> configurations;
+    for (int i = 0; i < ITERATIONS; ++i) {
+        configurations.push_back(MakeConfiguration(layer_manager.GetLayers(), i));
+    }
+
+    // Each iteration writes a different configuration so the unchanged content shortcut is not measured
+    QElapsedTimer timer_layers;
+    timer_layers.start();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        EXPECT_TRUE(WriteLayersOverride(environment, layer_manager.GetLayers(), configurations[i], layers_path));
+    }
+    Report("WriteLayersOverride", timer_layers, ITERATIONS);
+
+    QElapsedTimer timer_settings;
+    timer_settings.start();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        EXPECT_TRUE(WriteSettingsOverride(layer_manager.GetLayers(), configurations[i], settings_path));
+    }
+    Report("WriteSettingsOverride", timer_settings, ITERATIONS);
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST_F(benchmark_layers, export_html_doc) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadLayersFromPath(GetLayersPath());
+    ASSERT_EQ(BENCHMARK_LAYER_COUNT, layer_manager.GetLayers().size());
+
+    const std::string doc_path = GetPath("doc");
+
+    QElapsedTimer timer;
+    timer.start();
+    for (std::size_t i = 0, n = layer_manager.GetLayers().size(); i < n; ++i) {
+        const Layer& layer = layer_manager.GetLayers()[i];
+        ExportHtmlDoc(layer, doc_path + "/" + layer.key + ".html");
+    }
+    Report("ExportHtmlDoc", timer, BENCHMARK_LAYER_COUNT);
+
+    EXPECT_TRUE(QFile::exists((doc_path + "/" + GetLayerName(0) + ".html").c_str()));
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST_F(benchmark_layers, export_all_doc) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadLayersFromPath(GetLayersPath());
+    ASSERT_EQ(BENCHMARK_LAYER_COUNT, layer_manager.GetLayers().size());
+
+    const std::string doc_path = GetPath("doc");
+
+    QElapsedTimer timer;
+    timer.start();
+    EXPECT_TRUE(ExportAllDoc(layer_manager.GetLayers(), doc_path));
+    Report("ExportAllDoc", timer, BENCHMARK_LAYER_COUNT);
+
+    EXPECT_TRUE(QFile::exists((doc_path + "/index.html").c_str()));
+    EXPECT_TRUE(QFile::exists((doc_path + "/" + GetLayerName(BENCHMARK_LAYER_COUNT - 1) + ".md").c_str()));
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "../builtin.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDirIterator>
+#include <QJsonDocument>
+
+#include <gtest/gtest.h>
+
+TEST(test_builtin, not_builtin) {
+    QJsonDocument document;
+    EXPECT_FALSE(LoadBuiltinDocument(":/VK_LAYER_LUNARG_test_00.json", document));
+    EXPECT_FALSE(LoadBuiltinDocument("VK_LAYER_KHRONOS_validation.json", document));
+    EXPECT_EQ(nullptr, FindBuiltinFile(""));
+}
+
+#if VKCONFIG_BUILTIN_DATA
+// The data generated at build time is decoded as the same document as the resource JSON files
+TEST(test_builtin, layers_documents) {
+    QDirIterator it(":/layers", QStringList() << "*.json", QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString resource_path = it.next();
+        if (QFileInfo(resource_path).path() == ":/layers") continue;  // The schema and the valid usages are not layers manifests
+
+        // Every built-in layer manifest is generated, a missing one would be parsed as JSON without being noticed
+        const std::string path = resource_path.toStdString();
+        ASSERT_TRUE(FindBuiltinFile(path) != nullptr) << path;
+
+        QJsonDocument builtin_document;
+        EXPECT_TRUE(LoadBuiltinDocument(path, builtin_document));
+
+        QFile file(path.c_str());
+        EXPECT_TRUE(file.open(QIODevice::ReadOnly | QIODevice::Text));
+        const QJsonDocument& json_document = QJsonDocument::fromJson(file.readAll());
+
+        EXPECT_EQ(json_document.object(), builtin_document.object()) << path;
+    }
+}
+#endif  // VKCONFIG_BUILTIN_DATA
@@ -203,6 +203,69 @@ TEST(test_command_line, usage_mode_layers_override_invalid_args) {
     EXPECT_TRUE(command_line.layers_configuration_path.empty());
 }
 
+TEST(test_command_line, usage_mode_layers_batch) {
+    static char* argv[] = {"vkconfig", "layers", "--batch", "-"};
+    int argc = static_cast<int>(countof(argv));
+
+    CommandLine command_line(argc, argv);
+
+    EXPECT_EQ(ERROR_NONE, command_line.error);
+    EXPECT_TRUE(command_line.error_args.empty());
+    EXPECT_EQ(COMMAND_LAYERS, command_line.command);
+    EXPECT_EQ(COMMAND_LAYERS_BATCH, command_line.command_layers_arg);
+    EXPECT_STREQ("-", command_line.layers_script_path.c_str());
+    EXPECT_TRUE(command_line.layers_configuration_path.empty());
+}
+
+TEST(test_command_line, usage_mode_layers_batch_file_not_found) {
+    static char* argv[] = {"vkconfig", "layers", "--batch", "missing_script.txt"};
+    int argc = static_cast<int>(countof(argv));
+
+    CommandLine command_line(argc, argv);
+
+    EXPECT_EQ(ERROR_FILE_NOTFOUND, command_line.error);
+    EXPECT_EQ(1, command_line.error_args.size());
+    EXPECT_EQ(COMMAND_LAYERS, command_line.command);
+    EXPECT_EQ(COMMAND_LAYERS_BATCH, command_line.command_layers_arg);
+}
+
+TEST(test_command_line, usage_mode_daemon) {
+    static char* argv[] = {"vkconfig", "--daemon", "vkconfig_test"};
+    int argc = static_cast<int>(countof(argv));
+
+    CommandLine command_line(argc, argv);
+
+    EXPECT_EQ(ERROR_NONE, command_line.error);
+    EXPECT_TRUE(command_line.error_args.empty());
+    EXPECT_EQ(COMMAND_DAEMON, command_line.command);
+    EXPECT_STREQ("vkconfig_test", command_line.daemon_server_name.c_str());
+}
+
+TEST(test_command_line, usage_mode_daemon_invalid_args) {
+    static char* argv[] = {"vkconfig", "daemon", "bla", "blo"};
+    int argc = static_cast<int>(countof(argv));
+
+    CommandLine command_line(argc, argv);
+
+    EXPECT_EQ(ERROR_TOO_MANY_COMMAND_ARGUMENTS, command_line.error);
+    EXPECT_EQ(1, command_line.error_args.size());
+    EXPECT_EQ(COMMAND_DAEMON, command_line.command);
+}
+
+TEST(test_command_line, usage_mode_doc_all) {
+    static char* argv[] = {"vkconfig", "doc", "--all", "./doc"};
+    int argc = static_cast<int>(countof(argv));
+
+    CommandLine command_line(argc, argv);
+
+    EXPECT_EQ(ERROR_NONE, command_line.error);
+    EXPECT_TRUE(command_line.error_args.empty());
+    EXPECT_EQ(COMMAND_DOC, command_line.command);
+    EXPECT_EQ(COMMAND_DOC_ALL, command_line.command_doc_arg);
+    EXPECT_STREQ("./doc", command_line.doc_out_dir.c_str());
+    EXPECT_TRUE(command_line.doc_layer_name.empty());
+}
+
 #if VKC_PLATFORM == VKC_PLATFORM_LINUX
 #pragma GCC diagnostic pop
 #elif VKC_PLATFORM == VKC_PLATFORM_MACOS
@@ -77,6 +77,39 @@ TEST(test_configuration, load_and_save_v2_2_2) {
     EXPECT_EQ(configuration_loaded, configuration_saved);
 }
 
+TEST(test_configuration, settings_outlive_layers) {
+    const char* LAYER = "VK_LAYER_LUNARG_reference_1_2_1";
+
+    Configuration configuration;
+
+    {
+        std::vector<Layer> layers(1);
+        ASSERT_TRUE(layers[0].Load(std::vector<Layer>(), ":/VK_LAYER_LUNARG_reference_1_2_1.json", LAYER_TYPE_EXPLICIT));
+        ASSERT_TRUE(configuration.Load(layers, ":/Configuration 2.2.2.json"));
+    }
+
+    // The layers were deleted, the settings are kept alive by the configuration until they are instantiated again
+    Parameter* parameter = FindByKey(configuration.parameters, LAYER);
+    ASSERT_TRUE(parameter != nullptr);
+    ASSERT_FALSE(parameter->settings.empty());
+
+    const std::string key = parameter->settings[0]->key;
+    const std::string value = parameter->settings[0]->Export(EXPORT_MODE_OVERRIDE);
+
+    std::vector<Layer> reloaded_layers(1);
+    ASSERT_TRUE(reloaded_layers[0].Load(std::vector<Layer>(), ":/VK_LAYER_LUNARG_reference_1_2_1.json", LAYER_TYPE_EXPLICIT));
+
+    EXPECT_TRUE(configuration.RefreshLayers(reloaded_layers, std::vector<std::string>(1, LAYER)));
+
+    parameter = FindByKey(configuration.parameters, LAYER);
+    ASSERT_TRUE(parameter != nullptr);
+    EXPECT_EQ(reloaded_layers[0].GetSettingsMemory(), parameter->settings_memory);
+
+    const SettingData* setting = FindSetting(parameter->settings, key.c_str());
+    ASSERT_TRUE(setting != nullptr);
+    EXPECT_EQ(value, setting->Export(EXPORT_MODE_OVERRIDE));
+}
+
 static std::vector<Configuration> GenerateConfigurations() {
     std::vector<Configuration> configurations;
 
@@ -19,6 +19,9 @@
  */
 
 #include "../configuration_manager.h"
+#include "../util.h"
+
+#include <QFile>
 
 #include <gtest/gtest.h>
 
@@ -70,3 +73,28 @@ TEST(test_configuration_manager, create_remove) {
 
     environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
 }
+
+TEST(test_configuration_manager, load_all_configurations_read_only) {
+    PathManager path_manager("");
+    Environment environment(path_manager);
+    environment.Reset(Environment::DEFAULT);  // As the command line does, this is a first run for LoadAllConfigurations
+
+    std::vector<Layer> available_layers;
+
+    Configuration configuration;
+    configuration.key = "Test Read Only";
+    const std::string path = GetPath(BUILTIN_PATH_CONFIG_LAST) + "/" + configuration.key + ".json";
+    ASSERT_TRUE(configuration.Save(available_layers, path));
+
+    ConfigurationManager configuration_manager(environment);
+    configuration_manager.LoadAllConfigurationsReadOnly(available_layers);
+
+    // The configuration file of the user is kept and loaded
+    EXPECT_TRUE(QFile::exists(path.c_str()));
+    EXPECT_TRUE(FindByKey(configuration_manager.available_configurations, "Test Read Only") != nullptr);
+    EXPECT_EQ(nullptr, configuration_manager.GetActiveConfiguration());
+
+    QFile::remove(path.c_str());
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
@@ -29,14 +29,59 @@
 TEST(test_environment, remove_missing_applications) {
     PathManager path_manager("");
     Environment environment(path_manager);
+    environment.Reset(Environment::DEFAULT);
 
     QFile file("my_exciting_executable");
     const bool result = file.open(QIODevice::WriteOnly);
     ASSERT_TRUE(result);
 
-    std::vector<Application> applications;
-    applications.push_back(Application("missing", "my_missing_executable", ""));
-    applications.push_back(Application("exciting", "my_exciting_executable", ""));
+    const std::size_t default_count = environment.GetApplications().size();
+    EXPECT_EQ(true, environment.AppendApplication(Application("missing", "my_missing_executable", "")));
+    EXPECT_EQ(true, environment.AppendApplication(Application("exciting", "my_exciting_executable", "")));
+    EXPECT_EQ(true, environment.SaveApplications());
 
-    EXPECT_EQ(1, environment.RemoveMissingApplications(applications).size());
+    // The executables are searched on a worker thread, the missing applications are removed by SyncApplications
+    EXPECT_EQ(true, environment.LoadApplications());
+    EXPECT_EQ(default_count + 2, environment.GetApplications().size());
+
+    EXPECT_EQ(true, environment.SyncApplications(true));
+    EXPECT_EQ(true, environment.SyncApplications(false));
+
+    const std::vector<Application>& applications = environment.GetApplications();
+    bool has_missing = false;
+    bool has_exciting = false;
+    for (std::size_t i = 0, n = applications.size(); i < n; ++i) {
+        if (applications[i].app_name == "missing") has_missing = true;
+        if (applications[i].app_name == "exciting") has_exciting = true;
+    }
+    EXPECT_FALSE(has_missing);
+    EXPECT_TRUE(has_exciting);
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST(test_environment, active_application_index) {
+    PathManager path_manager("");
+    Environment environment(path_manager);
+    environment.Reset(Environment::DEFAULT);
+
+    const int first_index = static_cast<int>(environment.GetApplications().size());
+
+    EXPECT_EQ(true, environment.AppendApplication(Application("first", "my_first_executable", "")));
+    EXPECT_EQ(true, environment.AppendApplication(Application("second", "my_second_executable", "")));
+
+    environment.SelectActiveApplication(first_index + 1);
+    EXPECT_EQ(first_index + 1, environment.GetActiveApplicationIndex());
+    EXPECT_STREQ("second", environment.GetActiveApplication().app_name.c_str());
+
+    // The application is renamed in place
+    environment.GetApplication(first_index + 1).app_name = "renamed";
+    environment.Set(ACTIVE_APPLICATION, "renamed");
+    EXPECT_EQ(first_index + 1, environment.GetActiveApplicationIndex());
+
+    EXPECT_EQ(true, environment.RemoveApplication(first_index));
+    EXPECT_EQ(first_index, environment.GetActiveApplicationIndex());
+    EXPECT_STREQ("renamed", environment.GetActiveApplication().app_name.c_str());
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
 }
@@ -30,6 +30,7 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <regex>
 
 inline SettingMetaString* InstantiateString(Layer& layer, const std::string& key) {
@@ -71,7 +72,7 @@ TEST(test_layer, load_header_overridden) {
     EXPECT_EQ(STATUS_BETA, layer.status);
     EXPECT_STREQ("https://vulkan.lunarg.com/doc/sdk/latest/windows/layer_dummy.html", layer.url.c_str());
     EXPECT_TRUE(layer.settings.empty());
-    EXPECT_TRUE(layer.presets.empty());
+    EXPECT_TRUE(layer.GetPresets().empty());
 }
 
 TEST(test_layer, load_header_default) {
@@ -89,7 +90,7 @@ TEST(test_layer, load_header_default) {
     EXPECT_EQ(STATUS_STABLE, layer.status);
     EXPECT_TRUE(layer.url.empty());
     EXPECT_EQ(0, layer.settings.size());
-    EXPECT_EQ(0, layer.presets.size());
+    EXPECT_EQ(0, layer.GetPresets().size());
 }
 
 TEST(test_layer, load_header_override) {
@@ -101,7 +102,7 @@ TEST(test_layer, load_header_override) {
     EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.platforms);
     EXPECT_EQ(STATUS_BETA, layer.status);
     EXPECT_EQ(0, layer.settings.size());
-    EXPECT_EQ(0, layer.presets.size());
+    EXPECT_EQ(0, layer.GetPresets().size());
 }
 
 TEST(test_layer, load_setting_interit) {
@@ -113,7 +114,7 @@ TEST(test_layer, load_setting_interit) {
     EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.platforms);
     EXPECT_EQ(STATUS_BETA, layer.status);
     EXPECT_EQ(2, layer.settings.size());
-    EXPECT_EQ(0, layer.presets.size());
+    EXPECT_EQ(0, layer.GetPresets().size());
 
     EXPECT_STREQ("int_inherit", layer.settings[0]->key.c_str());
     EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.settings[0]->platform_flags);
@@ -135,15 +136,15 @@ TEST(test_layer, load_preset_interit) {
     EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.platforms);
     EXPECT_EQ(STATUS_BETA, layer.status);
     EXPECT_EQ(1, layer.settings.size());
-    EXPECT_EQ(2, layer.presets.size());
+    EXPECT_EQ(2, layer.GetPresets().size());
 
-    EXPECT_STREQ("Preset Inherit", layer.presets[0].label.c_str());
-    EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.presets[0].platform_flags);
-    EXPECT_EQ(STATUS_BETA, layer.presets[0].status);
+    EXPECT_STREQ("Preset Inherit", layer.GetPresets()[0].label.c_str());
+    EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.GetPresets()[0].platform_flags);
+    EXPECT_EQ(STATUS_BETA, layer.GetPresets()[0].status);
 
-    EXPECT_STREQ("Preset Override", layer.presets[1].label.c_str());
-    EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.presets[1].platform_flags);
-    EXPECT_EQ(STATUS_ALPHA, layer.presets[1].status);
+    EXPECT_STREQ("Preset Override", layer.GetPresets()[1].label.c_str());
+    EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[1].platform_flags);
+    EXPECT_EQ(STATUS_ALPHA, layer.GetPresets()[1].status);
 }
 
 TEST(test_layer, load_setting_children_interit) {
@@ -152,7 +153,7 @@ TEST(test_layer, load_setting_children_interit) {
     ASSERT_TRUE(load_loaded);
 
     EXPECT_EQ(Version(1, 2, 0), layer.file_format_version);
-    EXPECT_EQ(0, layer.presets.size());
+    EXPECT_EQ(0, layer.GetPresets().size());
     EXPECT_EQ(1, layer.settings.size());
     EXPECT_EQ(2, layer.settings[0]->children.size());
     EXPECT_EQ(3, CountSettings(layer.settings));
@@ -177,7 +178,7 @@ TEST(test_layer, load_setting_enum_interit) {
     EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT | PLATFORM_MACOS_BIT | PLATFORM_ANDROID_BIT, layer.platforms);
     EXPECT_EQ(STATUS_BETA, layer.status);
     EXPECT_EQ(2, layer.settings.size());
-    EXPECT_EQ(0, layer.presets.size());
+    EXPECT_EQ(0, layer.GetPresets().size());
 
     SettingMetaEnum* setting_inherit = static_cast<SettingMetaEnum*>(layer.settings[0]);
     EXPECT_EQ(2, setting_inherit->enum_values.size());
@@ -225,7 +226,7 @@ TEST(test_layer, load_1_1_0_header) {
     EXPECT_EQ(STATUS_STABLE, layer.status);
     EXPECT_TRUE(layer.url.empty());
     EXPECT_TRUE(layer.settings.empty());
-    EXPECT_TRUE(layer.presets.empty());
+    EXPECT_TRUE(layer.GetPresets().empty());
 }
 
 TEST(test_layer, load_1_2_0_preset_and_setting_type) {
@@ -238,16 +239,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 0;
 
         const SettingDataEnum* setting_only =
-            static_cast<const SettingDataEnum*>(FindSetting(layer.presets[index].settings, "enum_required_only"));
+            static_cast<const SettingDataEnum*>(FindSetting(layer.GetPresets()[index].settings, "enum_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataEnum* setting_opt =
-            static_cast<const SettingDataEnum*>(FindSetting(layer.presets[index].settings, "enum_with_optional"));
+            static_cast<const SettingDataEnum*>(FindSetting(layer.GetPresets()[index].settings, "enum_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset Enum", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Enum", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_DESKTOP_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_STABLE, layer.presets[index].status);
+        EXPECT_STREQ("Preset Enum", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Enum", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_DESKTOP_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_STABLE, layer.GetPresets()[index].status);
         EXPECT_STREQ("value2", setting_only->value.c_str());
         EXPECT_STREQ("value2", setting_opt->value.c_str());
     }
@@ -257,16 +258,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 1;
 
         const SettingDataFlags* setting_only =
-            static_cast<const SettingDataFlags*>(FindSetting(layer.presets[index].settings, "flags_required_only"));
+            static_cast<const SettingDataFlags*>(FindSetting(layer.GetPresets()[index].settings, "flags_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataFlags* setting_opt =
-            static_cast<const SettingDataFlags*>(FindSetting(layer.presets[index].settings, "flags_with_optional"));
+            static_cast<const SettingDataFlags*>(FindSetting(layer.GetPresets()[index].settings, "flags_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset Flags", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Flags", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_BETA, layer.presets[index].status);
+        EXPECT_STREQ("Preset Flags", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Flags", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_BETA, layer.GetPresets()[index].status);
         EXPECT_STREQ("flag0", setting_only->value[0].c_str());
         EXPECT_STREQ("flag2", setting_only->value[1].c_str());
         EXPECT_STREQ("flag0", setting_opt->value[0].c_str());
@@ -278,16 +279,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 2;
 
         const SettingDataFileLoad* setting_only =
-            static_cast<const SettingDataFileLoad*>(FindSetting(layer.presets[index].settings, "string_required_only"));
+            static_cast<const SettingDataFileLoad*>(FindSetting(layer.GetPresets()[index].settings, "string_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataFileLoad* setting_opt =
-            static_cast<const SettingDataFileLoad*>(FindSetting(layer.presets[index].settings, "string_with_optional"));
+            static_cast<const SettingDataFileLoad*>(FindSetting(layer.GetPresets()[index].settings, "string_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset String", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description String", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_ALPHA, layer.presets[index].status);
+        EXPECT_STREQ("Preset String", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description String", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_ALPHA, layer.GetPresets()[index].status);
         EXPECT_STREQ("Required Only", setting_only->value.c_str());
         EXPECT_STREQ("With Optional", setting_opt->value.c_str());
     }
@@ -296,14 +297,14 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
     {
         const std::size_t index = 3;
 
-        EXPECT_STREQ("Preset Bool", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Bool", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT | PLATFORM_MACOS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_DEPRECATED, layer.presets[index].status);
-        EXPECT_EQ(true,
-                  static_cast<const SettingDataBool*>(FindSetting(layer.presets[index].settings, "bool_required_only"))->value);
-        EXPECT_EQ(false,
-                  static_cast<const SettingDataBool*>(FindSetting(layer.presets[index].settings, "bool_with_optional"))->value);
+        EXPECT_STREQ("Preset Bool", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Bool", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_LINUX_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_DEPRECATED, layer.GetPresets()[index].status);
+        EXPECT_EQ(true, static_cast<const SettingDataBool*>(FindSetting(layer.GetPresets()[index].settings, "bool_required_only"))
+                          ->value);
+        EXPECT_EQ(false, static_cast<const SettingDataBool*>(FindSetting(layer.GetPresets()[index].settings, "bool_with_optional"))
+                          ->value);
     }
 
     // Preset Load File
@@ -311,16 +312,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 4;
 
         const SettingDataFileLoad* setting_only =
-            static_cast<const SettingDataFileLoad*>(FindSetting(layer.presets[index].settings, "load_file_required_only"));
+            static_cast<const SettingDataFileLoad*>(FindSetting(layer.GetPresets()[index].settings, "load_file_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataFileLoad* setting_opt =
-            static_cast<const SettingDataFileLoad*>(FindSetting(layer.presets[index].settings, "load_file_with_optional"));
+            static_cast<const SettingDataFileLoad*>(FindSetting(layer.GetPresets()[index].settings, "load_file_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset Load File", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Load File", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_DEPRECATED, layer.presets[index].status);
+        EXPECT_STREQ("Preset Load File", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Load File", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_DEPRECATED, layer.GetPresets()[index].status);
         EXPECT_STREQ("./text.log", setting_only->value.c_str());
         EXPECT_STREQ("./text.log", setting_opt->value.c_str());
     }
@@ -330,16 +331,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 5;
 
         const SettingDataFileSave* setting_only =
-            static_cast<const SettingDataFileSave*>(FindSetting(layer.presets[index].settings, "save_file_required_only"));
+            static_cast<const SettingDataFileSave*>(FindSetting(layer.GetPresets()[index].settings, "save_file_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataFileSave* setting_opt =
-            static_cast<const SettingDataFileSave*>(FindSetting(layer.presets[index].settings, "save_file_with_optional"));
+            static_cast<const SettingDataFileSave*>(FindSetting(layer.GetPresets()[index].settings, "save_file_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset Save File", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Save File", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_DEPRECATED, layer.presets[index].status);
+        EXPECT_STREQ("Preset Save File", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Save File", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_DEPRECATED, layer.GetPresets()[index].status);
         EXPECT_STREQ("./text.log", setting_only->value.c_str());
         EXPECT_STREQ("./text.log", setting_opt->value.c_str());
     }
@@ -349,16 +350,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 6;
 
         const SettingDataFolderSave* setting_only =
-            static_cast<const SettingDataFolderSave*>(FindSetting(layer.presets[index].settings, "save_folder_required_only"));
+            static_cast<const SettingDataFolderSave*>(FindSetting(layer.GetPresets()[index].settings, "save_folder_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataFolderSave* setting_opt =
-            static_cast<const SettingDataFolderSave*>(FindSetting(layer.presets[index].settings, "save_folder_with_optional"));
+            static_cast<const SettingDataFolderSave*>(FindSetting(layer.GetPresets()[index].settings, "save_folder_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset Save Folder", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Save Folder", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_DEPRECATED, layer.presets[index].status);
+        EXPECT_STREQ("Preset Save Folder", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Save Folder", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_DEPRECATED, layer.GetPresets()[index].status);
         EXPECT_STREQ("./text.log", setting_only->value.c_str());
         EXPECT_STREQ("./text.log", setting_opt->value.c_str());
     }
@@ -368,16 +369,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 7;
 
         const SettingDataInt* setting_only =
-            static_cast<const SettingDataInt*>(FindSetting(layer.presets[index].settings, "int_required_only"));
+            static_cast<const SettingDataInt*>(FindSetting(layer.GetPresets()[index].settings, "int_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataInt* setting_opt =
-            static_cast<const SettingDataInt*>(FindSetting(layer.presets[index].settings, "int_with_optional"));
+            static_cast<const SettingDataInt*>(FindSetting(layer.GetPresets()[index].settings, "int_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset Int", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Int", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_DEPRECATED, layer.presets[index].status);
+        EXPECT_STREQ("Preset Int", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Int", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_DEPRECATED, layer.GetPresets()[index].status);
         EXPECT_EQ(75, setting_only->value);
         EXPECT_EQ(77, setting_opt->value);
     }
@@ -386,15 +387,15 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
     {
         const std::size_t index = 8;
 
-        EXPECT_STREQ("Preset Frames", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description Frames", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_DEPRECATED, layer.presets[index].status);
+        EXPECT_STREQ("Preset Frames", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description Frames", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_DEPRECATED, layer.GetPresets()[index].status);
         EXPECT_STREQ("13-17,24-32",
-                     static_cast<const SettingDataFrames*>(FindSetting(layer.presets[index].settings, "frames_required_only"))
+                     static_cast<const SettingDataFrames*>(FindSetting(layer.GetPresets()[index].settings, "frames_required_only"))
                          ->value.c_str());
         EXPECT_STREQ("13-17,24,32",
-                     static_cast<const SettingDataFrames*>(FindSetting(layer.presets[index].settings, "frames_with_optional"))
+                     static_cast<const SettingDataFrames*>(FindSetting(layer.GetPresets()[index].settings, "frames_with_optional"))
                          ->value.c_str());
     }
 
@@ -403,16 +404,16 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         const std::size_t index = 9;
 
         const SettingDataList* setting_only =
-            static_cast<const SettingDataList*>(FindSetting(layer.presets[index].settings, "list_required_only"));
+            static_cast<const SettingDataList*>(FindSetting(layer.GetPresets()[index].settings, "list_required_only"));
         ASSERT_TRUE(setting_only);
         const SettingDataList* setting_opt =
-            static_cast<const SettingDataList*>(FindSetting(layer.presets[index].settings, "list_with_optional"));
+            static_cast<const SettingDataList*>(FindSetting(layer.GetPresets()[index].settings, "list_with_optional"));
         ASSERT_TRUE(setting_opt);
 
-        EXPECT_STREQ("Preset List", layer.presets[index].label.c_str());
-        EXPECT_STREQ("Description List", layer.presets[index].description.c_str());
-        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.presets[index].platform_flags);
-        EXPECT_EQ(STATUS_DEPRECATED, layer.presets[index].status);
+        EXPECT_STREQ("Preset List", layer.GetPresets()[index].label.c_str());
+        EXPECT_STREQ("Description List", layer.GetPresets()[index].description.c_str());
+        EXPECT_EQ(PLATFORM_WINDOWS_BIT | PLATFORM_MACOS_BIT, layer.GetPresets()[index].platform_flags);
+        EXPECT_EQ(STATUS_DEPRECATED, layer.GetPresets()[index].status);
         EXPECT_STREQ("stringA", setting_only->value[0].key.c_str());
         EXPECT_STREQ("stringB", setting_only->value[1].key.c_str());
         EXPECT_EQ(true, setting_only->value[0].enabled);
@@ -975,3 +976,83 @@ TEST(test_layer, load_1_2_0_preset_and_setting_type) {
         EXPECT_TRUE(setting_meta->list.empty());
     }
 }
+
+TEST(test_layer, find_setting_meta) {
+    Layer layer;
+    const bool load_loaded = layer.Load(std::vector<Layer>(), ":/VK_LAYER_LUNARG_reference_1_2_0.json", LAYER_TYPE_EXPLICIT);
+    ASSERT_TRUE(load_loaded);
+
+    // Collect the keys of all the settings, including child settings and enum values settings
+    SettingDataSet data_set;
+    CollectDefaultSettingData(layer.settings, data_set);
+    EXPECT_EQ(CountSettings(layer.settings), data_set.size());
+
+    for (std::size_t i = 0, n = data_set.size(); i < n; ++i) {
+        const SettingMeta* meta = layer.FindSettingMeta(data_set[i]->key);
+        ASSERT_TRUE(meta != nullptr);
+        EXPECT_EQ(FindSetting(layer.settings, data_set[i]->key.c_str()), meta);
+    }
+
+    EXPECT_EQ(nullptr, layer.FindSettingMeta("missing_setting"));
+}
+
+TEST(test_layer, copy_shared_settings) {
+    std::unique_ptr<Layer> layer_copy;
+
+    {
+        Layer layer;
+        const bool load_loaded = layer.Load(std::vector<Layer>(), ":/VK_LAYER_LUNARG_reference_1_2_0.json", LAYER_TYPE_EXPLICIT);
+        ASSERT_TRUE(load_loaded);
+
+        layer_copy.reset(new Layer(layer));
+
+        // The copy shares the settings metadata of the loaded layer
+        ASSERT_EQ(layer.settings.size(), layer_copy->settings.size());
+        for (std::size_t i = 0, n = layer.settings.size(); i < n; ++i) {
+            EXPECT_EQ(layer.settings[i], layer_copy->settings[i]);
+        }
+        EXPECT_EQ(layer.FindSettingMeta("enum_required_only"), layer_copy->FindSettingMeta("enum_required_only"));
+
+        // The presets are shared too
+        EXPECT_FALSE(layer.GetPresets().empty());
+        EXPECT_EQ(&layer.GetPresets(), &layer_copy->GetPresets());
+    }
+
+    // The settings metadata outlive the loaded layer
+    const SettingMeta* meta = layer_copy->FindSettingMeta("enum_required_only");
+    ASSERT_TRUE(meta != nullptr);
+    EXPECT_STREQ("enum_required_only", meta->key.c_str());
+    EXPECT_EQ(SETTING_ENUM, meta->type);
+    EXPECT_FALSE(layer_copy->GetPresets().empty());
+}
+
+TEST(test_layer, load_header_only) {
+    Layer layer_full;
+    const bool load_full = layer_full.Load(std::vector<Layer>(), ":/VK_LAYER_LUNARG_reference_1_2_1.json", LAYER_TYPE_EXPLICIT);
+    ASSERT_TRUE(load_full);
+    EXPECT_TRUE(layer_full.IsFeaturesLoaded());
+
+    Layer layer;
+    const bool load_header =
+        layer.Load(std::vector<Layer>(), ":/VK_LAYER_LUNARG_reference_1_2_1.json", LAYER_TYPE_EXPLICIT, LAYER_LOAD_HEADER);
+    ASSERT_TRUE(load_header);
+    EXPECT_FALSE(layer.IsFeaturesLoaded());
+
+    EXPECT_STREQ(layer_full.key.c_str(), layer.key.c_str());
+    EXPECT_EQ(layer_full.api_version, layer.api_version);
+    EXPECT_STREQ(layer_full.binary_path.c_str(), layer.binary_path.c_str());
+    EXPECT_TRUE(layer.settings.empty());
+    EXPECT_TRUE(layer.GetPresets().empty());
+    EXPECT_EQ(nullptr, layer.FindSettingMeta("enum_required_only"));
+
+    EXPECT_TRUE(layer.LoadFeatures());
+    EXPECT_TRUE(layer.IsFeaturesLoaded());
+
+    EXPECT_EQ(CountSettings(layer_full.settings), CountSettings(layer.settings));
+    EXPECT_EQ(layer_full.GetPresets().size(), layer.GetPresets().size());
+    EXPECT_TRUE(layer.FindSettingMeta("enum_required_only") != nullptr);
+
+    // Loading the features again does nothing
+    EXPECT_TRUE(layer.LoadFeatures());
+    EXPECT_EQ(CountSettings(layer_full.settings), CountSettings(layer.settings));
+}
@@ -20,6 +20,9 @@
 
 #include "../layer_manager.h"
 
+#include <QTemporaryDir>
+#include <QFile>
+
 #include <gtest/gtest.h>
 
 TEST(test_layer_manager, load_only_layer_json) {
@@ -30,7 +33,111 @@ TEST(test_layer_manager, load_only_layer_json) {
     LayerManager layer_manager(environment);
     layer_manager.LoadLayersFromPath(":/");
 
-    EXPECT_EQ(10, layer_manager.available_layers.size());
+    EXPECT_EQ(10, layer_manager.GetLayers().size());
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST(test_layer_manager, load_header_find_layer) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadLayersFromPath(":/", LAYER_LOAD_HEADER);
+
+    EXPECT_EQ(10, layer_manager.GetLayers().size());
+    for (std::size_t i = 0, n = layer_manager.GetLayers().size(); i < n; ++i) {
+        EXPECT_FALSE(layer_manager.GetLayers()[i].IsFeaturesLoaded());
+    }
+
+    // Finding a layer loads its settings
+    Layer* layer = layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1");
+    ASSERT_TRUE(layer != nullptr);
+    EXPECT_TRUE(layer->IsFeaturesLoaded());
+    EXPECT_TRUE(!layer->settings.empty());
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST(test_layer_manager, load_header_features_without_manifest) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString manifest_path = dir.path() + "/VK_LAYER_LUNARG_reference_1_2_1.json";
+    ASSERT_TRUE(QFile::copy(":/VK_LAYER_LUNARG_reference_1_2_1.json", manifest_path));
+    QFile::setPermissions(manifest_path, QFile::ReadOwner | QFile::WriteOwner);
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadLayersFromPath(dir.path().toStdString(), LAYER_LOAD_HEADER);
+    EXPECT_EQ(1, layer_manager.GetLayers().size());
+
+    const Layer* layer_header = layer_manager.FindLayerHeader("VK_LAYER_LUNARG_reference_1_2_1");
+    ASSERT_TRUE(layer_header != nullptr);
+    EXPECT_FALSE(layer_header->IsFeaturesAttempted());
+
+    // The features are loaded from the manifest parsed by the header load, the manifest is not read again
+    ASSERT_TRUE(QFile::remove(manifest_path));
+
+    Layer* layer = layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1");
+    ASSERT_TRUE(layer != nullptr);
+    EXPECT_TRUE(layer->IsFeaturesAttempted());
+    EXPECT_TRUE(layer->IsFeaturesLoaded());
+    EXPECT_TRUE(!layer->settings.empty());
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST(test_layer_manager, update_user_defined_layers) {
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+    environment.SetPerConfigUserDefinedLayersPaths(std::vector<std::string>());
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadAllInstalledLayers();
+
+    const std::size_t installed_layer_count = layer_manager.GetLayers().size();
+    EXPECT_TRUE(layer_manager.UpdateUserDefinedLayers().empty());
+
+    // Adding a path only loads the layers of this path
+    environment.SetPerConfigUserDefinedLayersPaths(std::vector<std::string>(1, ":/"));
+    EXPECT_EQ(10, layer_manager.UpdateUserDefinedLayers().size());
+    EXPECT_EQ(installed_layer_count + 10, layer_manager.GetLayers().size());
+    EXPECT_TRUE(layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1") != nullptr);
+
+    EXPECT_TRUE(layer_manager.UpdateUserDefinedLayers().empty());
+
+    // Adding a path with a higher precedence replaces the layer already loaded with the same key
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString manifest_path = dir.path() + "/VK_LAYER_LUNARG_reference_1_2_1.json";
+    ASSERT_TRUE(QFile::copy(":/VK_LAYER_LUNARG_reference_1_2_1.json", manifest_path));
+    QFile::setPermissions(manifest_path, QFile::ReadOwner | QFile::WriteOwner);
+
+    std::vector<std::string> user_defined_paths;
+    user_defined_paths.push_back(dir.path().toStdString());
+    user_defined_paths.push_back(":/");
+    environment.SetPerConfigUserDefinedLayersPaths(user_defined_paths);
+    EXPECT_EQ(1, layer_manager.UpdateUserDefinedLayers().size());
+    EXPECT_EQ(installed_layer_count + 10, layer_manager.GetLayers().size());
+    ASSERT_TRUE(layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1") != nullptr);
+    EXPECT_TRUE(QString(layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1")->manifest_path.c_str()).startsWith(dir.path()));
+
+    // Removing a path only unloads the layers of this path, the hidden layer is loaded again
+    environment.SetPerConfigUserDefinedLayersPaths(std::vector<std::string>(1, ":/"));
+    EXPECT_EQ(1, layer_manager.UpdateUserDefinedLayers().size());
+    EXPECT_EQ(installed_layer_count + 10, layer_manager.GetLayers().size());
+    ASSERT_TRUE(layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1") != nullptr);
+    EXPECT_FALSE(QString(layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1")->manifest_path.c_str()).startsWith(dir.path()));
+
+    environment.SetPerConfigUserDefinedLayersPaths(std::vector<std::string>());
+    EXPECT_EQ(10, layer_manager.UpdateUserDefinedLayers().size());
+    EXPECT_EQ(installed_layer_count, layer_manager.GetLayers().size());
+    EXPECT_EQ(nullptr, layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1"));
 
     environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
 }
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2020-2021 Valve Corporation
+ * Copyright (c) 2020-2021 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Authors:
+ * - Christophe Riccio <christophe@lunarg.com>
+ */
+
+#include "../layer_watcher.h"
+
+#include <QCoreApplication>
+#include <QTemporaryDir>
+#include <QFile>
+
+#include <gtest/gtest.h>
+
+static const char* MANIFEST_NAME = "VK_LAYER_LUNARG_reference_1_2_1.json";
+
+TEST(test_layer_watcher, update_manifests) {
+    int argc = 1;
+    char* argv[] = {const_cast<char*>("test_layer_watcher")};
+    QCoreApplication app(argc, argv);  // The file system watcher and the timers require an event dispatcher
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+    environment.SetPerConfigUserDefinedLayersPaths(std::vector<std::string>(1, dir.path().toStdString()));
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadAllInstalledLayers();
+
+    const std::size_t installed_layer_count = layer_manager.GetLayers().size();
+
+    LayerWatcher watcher(layer_manager);
+    EXPECT_FALSE(watcher.HasPendingChanges());
+
+    // Adding a manifest only loads its layer, the changes are notified directly rather than waiting for the file system
+    const QString manifest_path = dir.path() + "/" + MANIFEST_NAME;
+    ASSERT_TRUE(QFile::copy(QString(":/") + MANIFEST_NAME, manifest_path));
+    QFile::setPermissions(manifest_path, QFile::ReadOwner | QFile::WriteOwner);
+
+    watcher.OnPathChanged(dir.path());
+    EXPECT_TRUE(watcher.HasPendingChanges());
+    EXPECT_EQ(1, watcher.Apply().size());
+    EXPECT_FALSE(watcher.HasPendingChanges());
+    EXPECT_EQ(installed_layer_count + 1, layer_manager.GetLayers().size());
+    EXPECT_TRUE(layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1") != nullptr);
+
+    // Nothing changed
+    watcher.OnPathChanged(dir.path());
+    EXPECT_TRUE(watcher.Apply().empty());
+
+    // Removing a manifest only unloads its layer
+    ASSERT_TRUE(QFile::remove(manifest_path));
+
+    watcher.OnPathChanged(dir.path());
+    EXPECT_EQ(1, watcher.Apply().size());
+    EXPECT_EQ(installed_layer_count, layer_manager.GetLayers().size());
+    EXPECT_EQ(nullptr, layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1"));
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST(test_layer_watcher, invalid_manifest) {
+    int argc = 1;
+    char* argv[] = {const_cast<char*>("test_layer_watcher")};
+    QCoreApplication app(argc, argv);
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+    environment.SetPerConfigUserDefinedLayersPaths(std::vector<std::string>(1, dir.path().toStdString()));
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadAllInstalledLayers();
+
+    const std::size_t installed_layer_count = layer_manager.GetLayers().size();
+
+    LayerWatcher watcher(layer_manager);
+
+    // The manifest is loaded on a worker thread, its error is returned by Apply rather than shown with an alert
+    const QString manifest_path = dir.path() + "/VK_LAYER_LUNARG_invalid.json";
+    QFile file(manifest_path);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Text));
+    file.write("{\"file_format_version\": \"2.0.0\", \"layer\": {\"name\": \"VK_LAYER_LUNARG_invalid\"}}");
+    file.close();
+
+    watcher.OnPathChanged(dir.path());
+    EXPECT_TRUE(watcher.Apply().empty());
+    EXPECT_EQ(installed_layer_count, layer_manager.GetLayers().size());
+    EXPECT_EQ(nullptr, layer_manager.FindLayer("VK_LAYER_LUNARG_invalid"));
+
+    ASSERT_EQ(1, watcher.GetErrors().size());
+    EXPECT_EQ(manifest_path.toStdString(), watcher.GetErrors()[0].manifest_path);
+    EXPECT_FALSE(watcher.GetErrors()[0].message.empty());
+
+    // The errors are only reported by the Apply which loaded the manifest
+    watcher.OnPathChanged(dir.path());
+    watcher.Apply();
+    EXPECT_TRUE(watcher.GetErrors().empty());
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
+
+TEST(test_layer_watcher, apply_without_waiting) {
+    int argc = 1;
+    char* argv[] = {const_cast<char*>("test_layer_watcher")};
+    QCoreApplication app(argc, argv);
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    PathManager paths("");
+    Environment environment(paths);
+    environment.Reset(Environment::DEFAULT);
+    environment.SetPerConfigUserDefinedLayersPaths(std::vector<std::string>(1, dir.path().toStdString()));
+
+    LayerManager layer_manager(environment);
+    layer_manager.LoadAllInstalledLayers();
+
+    const std::size_t installed_layer_count = layer_manager.GetLayers().size();
+
+    LayerWatcher watcher(layer_manager);
+
+    const QString manifest_path = dir.path() + "/" + MANIFEST_NAME;
+    ASSERT_TRUE(QFile::copy(QString(":/") + MANIFEST_NAME, manifest_path));
+    QFile::setPermissions(manifest_path, QFile::ReadOwner | QFile::WriteOwner);
+
+    // The directory is not scanned yet, nothing is merged
+    watcher.OnPathChanged(dir.path());
+    EXPECT_FALSE(watcher.HasLoadedChanges());
+    EXPECT_TRUE(watcher.Apply(false).empty());
+    EXPECT_TRUE(watcher.HasPendingChanges());
+    EXPECT_EQ(installed_layer_count, layer_manager.GetLayers().size());
+
+    // Once scanned, the manifest is merged when loaded by the worker thread
+    watcher.OnScan();
+    while (!watcher.HasLoadedChanges()) {
+        QCoreApplication::processEvents();
+    }
+    EXPECT_EQ(1, watcher.Apply(false).size());
+    EXPECT_FALSE(watcher.HasLoadedChanges());
+    EXPECT_TRUE(layer_manager.FindLayer("VK_LAYER_LUNARG_reference_1_2_1") != nullptr);
+
+    environment.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
+}
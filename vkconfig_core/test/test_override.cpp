@@ -27,6 +27,9 @@
 #include <gtest/gtest.h>
 
 #include <QtGlobal>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
 
 #include <cstdlib>
 
@@ -52,12 +55,12 @@ TEST(test_override, write_erase_2_2_2) {
     layer_manager.LoadLayersFromPath(":/");
 
     Configuration configuration;
-    const bool load = configuration.Load(layer_manager.available_layers, ":/Configuration 2.2.2.json");
+    const bool load = configuration.Load(layer_manager.GetLayers(), ":/Configuration 2.2.2.json");
     EXPECT_TRUE(load);
     EXPECT_TRUE(!configuration.parameters.empty());
 
-    EXPECT_EQ(true, WriteLayersOverride(env, layer_manager.available_layers, configuration, "." + LAYERS));
-    EXPECT_EQ(true, WriteSettingsOverride(layer_manager.available_layers, configuration, "." + SETTINGS));
+    EXPECT_EQ(true, WriteLayersOverride(env, layer_manager.GetLayers(), configuration, "." + LAYERS));
+    EXPECT_EQ(true, WriteSettingsOverride(layer_manager.GetLayers(), configuration, "." + SETTINGS));
 
     QFile file_layers_override_ref((":" + LAYERS).c_str());
     const bool result_layers_override_ref = file_layers_override_ref.open(QIODevice::ReadOnly | QIODevice::Text);
@@ -109,11 +112,11 @@ TEST(test_override, vk_layer_settings_txt) {
     layer_manager.LoadLayersFromPath(":/");
 
     Configuration configuration;
-    const bool load = configuration.Load(layer_manager.available_layers, ":/Configuration 2.2.2.json");
+    const bool load = configuration.Load(layer_manager.GetLayers(), ":/Configuration 2.2.2.json");
     EXPECT_TRUE(load);
     EXPECT_TRUE(!configuration.parameters.empty());
 
-    EXPECT_EQ(true, OverrideConfiguration(env, layer_manager.available_layers, configuration));
+    EXPECT_EQ(true, OverrideConfiguration(env, layer_manager.GetLayers(), configuration));
 
     EXPECT_EQ(false, vku::IsLayerSetting(LAYER, "not_found"));
 
@@ -210,13 +213,13 @@ TEST(test_override, env_var) {
     layer_manager.LoadLayersFromPath(":/");
 
     Configuration configuration;
-    const bool load = configuration.Load(layer_manager.available_layers, ":/Configuration 2.2.2.json");
+    const bool load = configuration.Load(layer_manager.GetLayers(), ":/Configuration 2.2.2.json");
     EXPECT_TRUE(load);
     EXPECT_TRUE(!configuration.parameters.empty());
 
     qputenv("VK_LAYER_SETTINGS_PATH", "./vk_layer_settings.txt");
 
-    EXPECT_EQ(true, OverrideConfiguration(env, layer_manager.available_layers, configuration));
+    EXPECT_EQ(true, OverrideConfiguration(env, layer_manager.GetLayers(), configuration));
 
     EXPECT_EQ(false, vku::IsLayerSetting(LAYER, "env_o"));
 
@@ -238,3 +241,34 @@ TEST(test_override, env_var) {
 
     env.Reset(Environment::SYSTEM);  // Don't change the system settings on exit
 }
+
+TEST(test_override, write_unchanged_file) {
+    const std::string PATH("./override_write_unchanged.txt");
+
+    EXPECT_EQ(true, WriteOverrideFile(PATH, "setting = value_a\n"));
+
+    // Make the file look old to detect whether it's written again
+    const QDateTime old_time = QDateTime::currentDateTime().addDays(-1);
+    {
+        QFile file(PATH.c_str());
+        ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+        EXPECT_TRUE(file.setFileTime(old_time, QFileDevice::FileModificationTime));
+        file.close();
+    }
+    const QDateTime time_written = QFileInfo(PATH.c_str()).lastModified();
+
+    // Same content, the file is left untouched
+    EXPECT_EQ(true, WriteOverrideFile(PATH, "setting = value_a\n"));
+    EXPECT_EQ(time_written, QFileInfo(PATH.c_str()).lastModified());
+
+    // New content, the file is replaced
+    EXPECT_EQ(true, WriteOverrideFile(PATH, "setting = value_b\n"));
+    EXPECT_NE(time_written, QFileInfo(PATH.c_str()).lastModified());
+
+    QFile file(PATH.c_str());
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly | QIODevice::Text));
+    EXPECT_STREQ("setting = value_b\n", file.readAll().toStdString().c_str());
+    file.close();
+
+    EXPECT_EQ(true, EraseSettingsOverride(PATH));
+}
@@ -93,6 +93,26 @@ TEST(test_setting_type_list, value) {
     EXPECT_STREQ("D,E", dataC->Export(EXPORT_MODE_OVERRIDE).c_str());
 }
 
+TEST(test_setting_type_list, find_value_index) {
+    Layer layer;
+
+    SettingMetaList* meta = InstantiateList(layer, "key");
+    meta->list.push_back(NumberOrString(76));
+    meta->list.push_back(NumberOrString(82));
+    meta->list.push_back(NumberOrString("A"));
+    meta->list.push_back(NumberOrString("B"));
+    meta->list.push_back(NumberOrString("D"));
+
+    EXPECT_EQ(0, meta->FindValueIndex(NumberOrString(76)));
+    EXPECT_EQ(1, meta->FindValueIndex(NumberOrString("82")));
+    EXPECT_EQ(2, meta->FindValueIndex(NumberOrString("A")));
+    EXPECT_EQ(4, meta->FindValueIndex(NumberOrString("D")));
+
+    EXPECT_EQ(-1, meta->FindValueIndex(NumberOrString(77)));
+    EXPECT_EQ(-1, meta->FindValueIndex(NumberOrString("C")));
+    EXPECT_EQ(-1, meta->FindValueIndex(NumberOrString("E")));
+}
+
 void LoadVUIDs(std::vector<NumberOrString>& value);
 
 TEST(test_setting_type_list, validation_list) {
@@ -213,6 +213,57 @@ TEST(test_util, format_find) {
     EXPECT_EQ(false, IsFound(container, "D"));
 }
 
+TEST(test_util, key_index_find) {
+    struct Element {
+        std::string key;
+        int value;
+    };
+
+    std::vector<Element> container;
+
+    KeyIndex<Element> index(container);
+    EXPECT_EQ(nullptr, index.Find(container, "D"));
+    EXPECT_EQ(false, index.IsFound("D"));
+
+    Element elementA;
+    elementA.key = "A";
+    elementA.value = 0;
+    Element elementB;
+    elementB.key = "B";
+    elementB.value = 1;
+    Element elementC;
+    elementC.key = "C";
+    elementC.value = 2;
+    Element elementA_duplicate;
+    elementA_duplicate.key = "A";
+    elementA_duplicate.value = 3;
+
+    container.push_back(elementA);
+    container.push_back(elementB);
+    index.Build(container);
+
+    // Insert after the container storage may have been reallocated
+    container.push_back(elementC);
+    index.Insert(container, container.size() - 1);
+    container.push_back(elementA_duplicate);
+    index.Insert(container, container.size() - 1);
+
+    EXPECT_STREQ("A", index.Find(container, "A")->key.c_str());
+    EXPECT_EQ(0, index.Find(container, "A")->value);
+    EXPECT_STREQ("B", index.Find(container, "B")->key.c_str());
+    EXPECT_STREQ("C", index.Find(container, "C")->key.c_str());
+    EXPECT_EQ(nullptr, index.Find(container, "D"));
+
+    EXPECT_EQ(FindByKey(container, "A"), index.Find(container, "A"));
+    EXPECT_EQ(FindByKey(container, "C"), index.Find(container, "C"));
+
+    EXPECT_EQ(true, index.IsFound("C"));
+    EXPECT_EQ(false, index.IsFound("D"));
+
+    index.Clear();
+    EXPECT_EQ(false, index.IsFound("A"));
+}
+
 TEST(test_util, to_lower_case) {
     EXPECT_STREQ("string", ToLowerCase("string").c_str());
     EXPECT_STREQ(" string", ToLowerCase(" string").c_str());
@@ -35,6 +35,7 @@
 #include <string>
 #include <vector>
 #include <array>
+#include <unordered_map>
 
 // Based on https://www.g-truc.net/post-0708.html#menu
 template <typename T, std::size_t N>
@@ -90,6 +91,61 @@ bool IsFound(const std::vector<T>& container, const char* key) {
     return FindByKey(container, key) != nullptr;
 }
 
+// Hash index of the elements of a container by 'key'. Elements are referenced by position so that the index remains valid when
+// the container storage grows. It needs to be rebuilt when elements are removed, reordered or renamed.
+template <typename T>
+class KeyIndex {
+   public:
+    KeyIndex() {}
+    explicit KeyIndex(const std::vector<T>& container) { this->Build(container); }
+
+    void Build(const std::vector<T>& container) {
+        this->positions.clear();
+        this->positions.reserve(container.size());
+
+        for (std::size_t i = 0, n = container.size(); i < n; ++i) {
+            this->positions.insert(std::make_pair(container[i].key, i));  // Keep the first element found, like FindByKey
+        }
+    }
+
+    void Insert(const std::vector<T>& container, std::size_t position) {
+        assert(position < container.size());
+
+        this->positions.insert(std::make_pair(container[position].key, position));
+    }
+
+    void Clear() { this->positions.clear(); }
+
+    T* Find(std::vector<T>& container, const char* key) const {
+        assert(key != nullptr);
+        assert(std::strcmp(key, "") != 0);
+
+        const auto it = this->positions.find(key);
+        if (it == this->positions.end()) return nullptr;
+
+        assert(it->second < container.size());
+        assert(container[it->second].key == key);
+        return &container[it->second];
+    }
+
+    const T* Find(const std::vector<T>& container, const char* key) const {
+        assert(key != nullptr);
+        assert(std::strcmp(key, "") != 0);
+
+        const auto it = this->positions.find(key);
+        if (it == this->positions.end()) return nullptr;
+
+        assert(it->second < container.size());
+        assert(container[it->second].key == key);
+        return &container[it->second];
+    }
+
+    bool IsFound(const char* key) const { return this->positions.find(key) != this->positions.end(); }
+
+   private:
+    std::unordered_map<std::string, std::size_t> positions;
+};
+
 // Remove a value if it's present
 void RemoveString(std::vector<std::string>& list, const std::string& value);
 